@@ -0,0 +1,161 @@
+"""Performance regression harness comparing two builds of the solver
+
+Runs every benchmark against a baseline and a candidate build, interleaving the runs (in random
+order within each round) so that drifts in machine load affect both builds alike. Per run, the
+final line of the JSON statistics stream (-stats-fd) is collected, so both builds must support it.
+
+Deterministic work counters (conflicts, propagations, ...) are compared exactly: with identical
+options both builds should do the same search, so any difference means the search itself changed,
+and a counter that grows by more than --threshold is flagged as a regression. CPU times are compared
+with a two-sided Mann-Whitney U test; a benchmark is flagged as a slowdown if the candidate's median
+is more than --threshold slower and the difference is significant at --alpha. The exit status is 1
+if any slowdown or counter regression was flagged, so the script can gate CI.
+
+Example:
+
+    python3 compare_builds.py --base old/minisat --new build/minisat --runs 7 benchmarks/*.cnf
+
+To compare two builds of the shared library with the same binary, use --base-lib/--new-lib to
+point LD_LIBRARY_PATH at the respective library directories.
+"""
+
+import argparse
+import json
+import math
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+COUNTERS = ["conflicts", "decisions", "propagations", "restarts", "ticks"]
+
+
+def run_once(binary, libdir, bench, extra, timeout):
+    """Runs the solver once and returns the final statistics record (or None on timeout)."""
+    env = dict(os.environ)
+    if libdir:
+        env["LD_LIBRARY_PATH"] = libdir + os.pathsep + env.get("LD_LIBRARY_PATH", "")
+    with tempfile.TemporaryFile() as stats:
+        fd = stats.fileno()
+        cmd = [binary, "-verb=0", "-stats-fd=%d" % fd, "-stats-confl=0", "-stats-time=0"] + extra + [bench]
+        try:
+            subprocess.run(cmd, env=env, pass_fds=(fd,), stdout=subprocess.DEVNULL,
+                           stderr=subprocess.DEVNULL, timeout=timeout)
+        except subprocess.TimeoutExpired:
+            return None
+        stats.seek(0)
+        records = [json.loads(line) for line in stats.read().decode().splitlines() if line.strip()]
+    solves = [r for r in records if r.get("event") == "solve"]
+    return solves[-1] if solves else None
+
+
+def mann_whitney(xs, ys):
+    """Two-sided Mann-Whitney U test (normal approximation with tie correction). Returns a p-value."""
+    n1, n2 = len(xs), len(ys)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+    pooled = sorted([(x, 0) for x in xs] + [(y, 1) for y in ys])
+    ranks = [0.0] * len(pooled)
+    ties = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1
+        t = j - i + 1
+        ties += t ** 3 - t
+        i = j + 1
+    r1 = sum(r for r, (_, g) in zip(ranks, pooled) if g == 0)
+    u = r1 - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    var = n1 * n2 / 12.0 * ((n + 1) - ties / (n * (n - 1)))
+    if var <= 0:
+        return 1.0
+    z = (abs(u - n1 * n2 / 2.0) - 0.5) / math.sqrt(var)
+    return math.erfc(max(z, 0.0) / math.sqrt(2))
+
+
+def median(xs):
+    s = sorted(xs)
+    return (s[len(s) // 2] + s[(len(s) - 1) // 2]) / 2.0 if s else float("nan")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--base", required=True, help="baseline solver binary")
+    ap.add_argument("--new", required=True, help="candidate solver binary")
+    ap.add_argument("--base-lib", help="LD_LIBRARY_PATH entry for the baseline runs")
+    ap.add_argument("--new-lib", help="LD_LIBRARY_PATH entry for the candidate runs")
+    ap.add_argument("--runs", type=int, default=5, help="runs per build and benchmark (default 5)")
+    ap.add_argument("--timeout", type=float, default=300, help="per-run timeout in seconds")
+    ap.add_argument("--threshold", type=float, default=0.05, help="relative slowdown to flag (default 0.05)")
+    ap.add_argument("--alpha", type=float, default=0.05, help="significance level (default 0.05)")
+    ap.add_argument("--seed", type=int, default=1, help="seed for the run order")
+    ap.add_argument("--solver-args", default="", help="extra options passed to both builds")
+    ap.add_argument("benchmarks", nargs="+")
+    args = ap.parse_args()
+
+    rng = random.Random(args.seed)
+    extra = args.solver_args.split()
+    builds = {"base": (args.base, args.base_lib), "new": (args.new, args.new_lib)}
+    results = {b: {"base": [], "new": []} for b in args.benchmarks}
+
+    for r in range(args.runs):
+        for bench in args.benchmarks:
+            order = ["base", "new"]
+            rng.shuffle(order)
+            for which in order:
+                binary, libdir = builds[which]
+                results[bench][which].append(run_once(binary, libdir, bench, extra, args.timeout))
+        print("round %d/%d done" % (r + 1, args.runs), file=sys.stderr)
+
+    flagged = 0
+    ratios = []
+    print("%-40s %10s %10s %8s %8s  %s" % ("benchmark", "base[s]", "new[s]", "ratio", "p", "notes"))
+    for bench in args.benchmarks:
+        notes = []
+        base = results[bench]["base"]
+        new = results[bench]["new"]
+        tb = [x["cpu_time"] if x else args.timeout for x in base]
+        tn = [x["cpu_time"] if x else args.timeout for x in new]
+        if None in base or None in new:
+            notes.append("timeouts %d/%d" % (base.count(None), new.count(None)))
+
+        # Work counters: report any difference between the builds (and any nondeterminism within one),
+        # and flag growth beyond the threshold:
+        regressed = False
+        for c in COUNTERS:
+            vb = set(x[c] for x in base if x and c in x)
+            vn = set(x[c] for x in new if x and c in x)
+            if len(vb) > 1 or len(vn) > 1:
+                notes.append("%s nondeterministic" % c)
+            elif vb and vn and vb != vn:
+                b, n = vb.pop(), vn.pop()
+                growth = (n - b) / float(b) if b else float("inf")
+                notes.append("%s %+.1f%%" % (c, 100.0 * growth))
+                if growth > args.threshold:
+                    regressed = True
+        if regressed:
+            notes.append("COUNTER REGRESSION")
+            flagged += 1
+
+        mb, mn = median(tb), median(tn)
+        ratio = mn / mb if mb > 0 else 1.0
+        ratios.append(ratio)
+        p = mann_whitney(tb, tn)
+        if ratio > 1 + args.threshold and p < args.alpha:
+            notes.append("SLOWDOWN")
+            if not regressed:
+                flagged += 1
+        print("%-40s %10.3f %10.3f %8.3f %8.4f  %s" % (os.path.basename(bench)[:40], mb, mn, ratio, p, ", ".join(notes)))
+
+    geo = math.exp(sum(math.log(max(r, 1e-9)) for r in ratios) / len(ratios))
+    print("geometric mean time ratio (new/base): %.3f, flagged benchmarks: %d" % (geo, flagged))
+    sys.exit(1 if flagged > 0 else 0)
+
+
+if __name__ == "__main__":
+    main()
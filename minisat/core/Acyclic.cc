@@ -0,0 +1,190 @@
+/**************************************************************************************[Acyclic.cc]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+
+#include "minisat/core/Acyclic.h"
+#include "minisat/core/Solver.h"
+
+using namespace Minisat;
+
+
+AcyclicPropagator::AcyclicPropagator(int n_, const vec<Lit>& as) :
+    insertions(0), propagations(0), conflicts(0), n(n_), inserted(0), stamp(0)
+{
+    assert(as.size() == n*n);
+    out     .growTo(n);
+    true_out.growTo(n);
+    true_in .growTo(n);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++){
+            Lit a = as[i*n + j];
+            if (a == lit_Undef) continue;
+            assert(i != j);
+            out[i].push(lits.size());
+            lits.push(a);
+            from.push(i);
+            to  .push(j);
+            arcs_of     .growTo(2*(var(a)+1));
+            reason_start.growTo(2*(var(a)+1), 0);
+            reason_size .growTo(2*(var(a)+1), 0);
+            arcs_of[toInt(a)].push(lits.size() - 1);
+        }
+    fwd_seen.growTo(n, 0);
+    fwd_via .growTo(n);
+    bwd_seen.growTo(n, 0);
+    bwd_via .growTo(n);
+}
+
+
+void AcyclicPropagator::attach(Solver& S)
+{
+    // Arcs already true (and propagated) are inserted by the first fixpoint:
+    for (int a = 0; a < lits.size(); a++){
+        if (S.value(lits[a]) == l_True)
+            added.push(a);
+        if (arcs_of[toInt(lits[a])][0] == a)
+            S.watchLit(lits[a], this); }
+    S.addPropagator(this);
+}
+
+
+bool AcyclicPropagator::propagate(Solver&, Lit p, vec<Lit>&)
+{
+    const vec<int>& as = arcs_of[toInt(p)];
+    for (int i = 0; i < as.size(); i++)
+        added.push(as[i]);
+    return true;
+}
+
+
+void AcyclicPropagator::backtrack(Solver& S, int)
+{
+    while (added.size() > 0 && S.value(lits[added.last()]) == l_Undef){
+        if (added.size() == inserted){
+            int a = added.last();
+            assert(true_out[from[a]].last() == a && true_in[to[a]].last() == a);
+            true_out[from[a]].pop();
+            true_in [to[a]]  .pop();
+            inserted--; }
+        added.pop(); }
+    while (implied.size() > 0 && S.value(implied.last()) == l_Undef){
+        reasons.shrink(reasons.size() - reason_start[toInt(implied.last())]);
+        implied.pop(); }
+}
+
+
+bool AcyclicPropagator::fixpoint(Solver& S, vec<Lit>& out_conflict)
+{
+    while (inserted < added.size())
+        if (!insert(S, added[inserted], out_conflict))
+            return false;
+    return true;
+}
+
+
+bool AcyclicPropagator::insert(Solver& S, int a, vec<Lit>& out_conflict)
+{
+    int u = from[a], v = to[a];
+    insertions++;
+    stamp++;
+
+    // Search forward from 'v':
+    fwd.clear();
+    stack.clear();
+    fwd_seen[v] = stamp;
+    fwd.push(v);
+    stack.push(v);
+    while (stack.size() > 0){
+        int x = stack.last(); stack.pop();
+        for (int i = 0; i < true_out[x].size(); i++){
+            int b = true_out[x][i], y = to[b];
+            S.ticks++;
+            if (fwd_seen[y] == stamp) continue;
+            fwd_seen[y] = stamp;
+            fwd_via [y] = b;
+            if (y == u){
+                conflicts++;
+                out_conflict.push(~lits[a]);
+                pathTo(v, u, out_conflict);
+                return false; }
+            fwd.push(y);
+            stack.push(y);
+        }
+    }
+
+    // Search backward from 'u':
+    bwd_seen[u] = stamp;
+    stack.push(u);
+    while (stack.size() > 0){
+        int y = stack.last(); stack.pop();
+        for (int i = 0; i < true_in[y].size(); i++){
+            int b = true_in[y][i], x = from[b];
+            S.ticks++;
+            if (bwd_seen[x] == stamp) continue;
+            bwd_seen[x] = stamp;
+            bwd_via [x] = b;
+            stack.push(x);
+        }
+    }
+
+    true_out[u].push(a);
+    true_in [v].push(a);
+    inserted++;
+
+    // Imply the arcs from the forward to the backward vertices false:
+    for (int k = 0; k < fwd.size(); k++){
+        int x = fwd[k];
+        for (int i = 0; i < out[x].size(); i++){
+            int b = out[x][i], y = to[b];
+            S.ticks++;
+            if (bwd_seen[y] != stamp || S.value(lits[b]) != l_Undef) continue;
+            Lit z = ~lits[b];
+            reason_start[toInt(z)] = reasons.size();
+            reasons.push(~lits[a]);
+            pathTo  (v, x, reasons);
+            pathFrom(y, u, reasons);
+            reason_size[toInt(z)]  = reasons.size() - reason_start[toInt(z)];
+            implied.push(z);
+            S.enqueueLazy(z, this);
+            propagations++;
+        }
+    }
+    return true;
+}
+
+
+void AcyclicPropagator::pathTo(int v, int x, vec<Lit>& out) const
+{
+    for (; x != v; x = from[fwd_via[x]])
+        out.push(~lits[fwd_via[x]]);
+}
+
+
+void AcyclicPropagator::pathFrom(int y, int u, vec<Lit>& out) const
+{
+    for (; y != u; y = to[bwd_via[y]])
+        out.push(~lits[bwd_via[y]]);
+}
+
+
+void AcyclicPropagator::explain(Solver&, Lit p, vec<Lit>& out_reason)
+{
+    int l = toInt(p);
+    out_reason.push(p);
+    for (int i = reason_start[l]; i < reason_start[l] + reason_size[l]; i++)
+        out_reason.push(reasons[i]);
+}
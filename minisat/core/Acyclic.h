@@ -0,0 +1,83 @@
+/***************************************************************************************[Acyclic.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Acyclic_h
+#define Minisat_Acyclic_h
+
+#include "minisat/mtl/Vec.h"
+#include "minisat/core/Propagator.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// AcyclicPropagator -- requires a directed graph to be acyclic:
+//
+// The graph on 'n' vertices is given by the literals of its arcs, where 'lit_Undef' marks pairs
+// that are never adjacent. Arcs that became true are inserted into the graph one at a time, in
+// trail order, and removed again by backtracking. Inserting 'u -> v' searches forward from 'v' over
+// the true arcs: reaching 'u' closes a cycle, whose arcs are the conflict. Otherwise every
+// unassigned arc from a vertex reachable from 'v' to one reaching 'u' would close a cycle and is
+// implied false, with the arcs of that cycle as the reason. Arcs may share literals, as in
+// orientation encodings, where the arc from 'i' to 'j' is 'x' and the one back is '~x'.
+
+class AcyclicPropagator : public Propagator {
+public:
+    AcyclicPropagator(int n, const vec<Lit>& arcs); // 'arcs[i*n+j]': the arc from 'i' to 'j' (no loops).
+
+    void     attach   (Solver& S);
+
+    bool     propagate(Solver& S, Lit p, vec<Lit>& out_conflict);
+    bool     fixpoint (Solver& S, vec<Lit>& out_conflict);
+    void     explain  (Solver& S, Lit p, vec<Lit>& out_reason);
+    void     backtrack(Solver& S, int level);
+
+    // Statistics:
+    //
+    uint64_t insertions, propagations, conflicts;
+
+protected:
+    int             n;
+    vec<Lit>        lits;           // The literal and endpoints of each arc.
+    vec<int>        from, to;
+    vec<vec<int> >  arcs_of;        // The arcs of each literal ('toInt()').
+    vec<vec<int> >  out;            // The arcs leaving each vertex,
+    vec<vec<int> >  true_out;       // and the inserted ones leaving and entering it.
+    vec<vec<int> >  true_in;
+    vec<int>        added;          // The true arcs in trail order,
+    int             inserted;       // of which this many are inserted.
+
+    vec<int>        fwd_seen;       // Stamp of the last search that reached each vertex forward,
+    vec<int>        fwd_via;        // and the arc it was reached by;
+    vec<int>        bwd_seen;       // the same backward.
+    vec<int>        bwd_via;
+    int             stamp;
+    vec<int>        fwd, stack;     // The vertices reached forward.
+
+    vec<Lit>        reasons;        // Reasons of the implied literals (without them), in trail order,
+    vec<int>        reason_start;   // where the reason of each literal ('toInt()') starts, and its size,
+    vec<int>        reason_size;
+    vec<Lit>        implied;        // and the implied literals.
+
+    bool     insert   (Solver& S, int a, vec<Lit>& out_conflict);
+    void     pathTo   (int v, int x, vec<Lit>& out) const; // The arcs from 'v' forward to 'x' (negated).
+    void     pathFrom (int y, int u, vec<Lit>& out) const; // The arcs from 'y' backward to 'u' (negated).
+};
+
+//=================================================================================================
+}
+
+#endif
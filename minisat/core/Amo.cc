@@ -0,0 +1,75 @@
+/******************************************************************************************[Amo.cc]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#include "minisat/core/Amo.h"
+#include "minisat/core/Solver.h"
+
+using namespace Minisat;
+
+
+AmoPropagator::AmoPropagator() : propagations(0), conflicts(0) {}
+
+
+void AmoPropagator::addAtMostOne(Solver& S, const vec<Lit>& ls)
+{
+    assert(ls.size() > 2);
+    Amo c = { lits.size(), ls.size() };
+    for (int i = 0; i < ls.size(); i++){
+        Lit p = ls[i];
+        assert(S.value(p) == l_Undef);
+        lits.push(p);
+        occs.growTo(2*(var(p)+1));
+        if (occs[toInt(p)].size() == 0)
+            S.watchLit(p, this);
+        occs[toInt(p)].push(amos.size());
+        reason_lit.growTo(var(p)+1, lit_Undef);
+    }
+    amos.push(c);
+}
+
+
+bool AmoPropagator::propagate(Solver& S, Lit p, vec<Lit>& out_conflict)
+{
+    const vec<int>& cs = occs[toInt(p)];
+    for (int i = 0; i < cs.size(); i++){
+        const Amo& c = amos[cs[i]];
+        S.ticks += c.size;
+        for (int j = c.start; j < c.start + c.size; j++){
+            Lit q = lits[j];
+            if (q == p) continue;
+            lbool val = S.value(q);
+            if (val == l_True){
+                conflicts++;
+                out_conflict.push(~p);
+                out_conflict.push(~q);
+                return false;
+            }else if (val == l_Undef){
+                reason_lit[var(q)] = p;
+                S.enqueueLazy(~q, this);
+                propagations++; }
+        }
+    }
+    return true;
+}
+
+
+void AmoPropagator::explain(Solver&, Lit p, vec<Lit>& out_reason)
+{
+    assert(reason_lit[var(p)] != lit_Undef);
+    out_reason.push(p);
+    out_reason.push(~reason_lit[var(p)]);
+}
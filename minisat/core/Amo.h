@@ -0,0 +1,60 @@
+/*******************************************************************************************[Amo.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Amo_h
+#define Minisat_Amo_h
+
+#include "minisat/mtl/Vec.h"
+#include "minisat/core/Propagator.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// AmoPropagator -- at-most-one constraints over literals:
+//
+// Each constraint is stored once as its list of literals, instead of a binary clause for every
+// pair. Once one of them is true, the others are implied false, each with the binary reason
+// '~q | ~p'; a second true literal is a conflict with the first. Nothing has to be undone when
+// backtracking.
+
+class AmoPropagator : public Propagator {
+public:
+    AmoPropagator();
+
+    void     addAtMostOne(Solver& S, const vec<Lit>& lits); // Literals must be unassigned and distinct, at least 3 of them.
+    int      nConstraints() const { return amos.size(); }
+
+    bool     propagate(Solver& S, Lit p, vec<Lit>& out_conflict);
+    void     explain  (Solver& S, Lit p, vec<Lit>& out_reason);
+
+    // Statistics:
+    //
+    uint64_t propagations, conflicts;
+
+protected:
+    struct Amo { int start, size; };
+
+    vec<Amo>        amos;
+    vec<Lit>        lits;           // Literals of all constraints ('start' and 'size' index into this).
+    vec<vec<int> >  occs;           // 'occs[toInt(p)]': the constraints containing 'p'.
+    vec<Lit>        reason_lit;     // The true literal that implied each variable (if one did).
+};
+
+//=================================================================================================
+}
+
+#endif
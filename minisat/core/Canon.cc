@@ -0,0 +1,272 @@
+/****************************************************************************************[Canon.cc]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#include "minisat/core/Canon.h"
+#include "minisat/core/Solver.h"
+
+using namespace Minisat;
+
+
+static inline uint64_t splitmix64(uint64_t& x){
+    uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31); }
+
+
+CanonPropagator::CanonPropagator(int n_, const vec<Lit>& es, int cutoff_, int freq_, int cache_bits) :
+    checks(0), aborted(0), propagations(0), conflicts(0), cache_hits(0), refuter_hits(0),
+    n(n_), cutoff(cutoff_), freq(freq_), dirty(true), skipped(0), jump(0), nodes(0), node_limit(-1), hash(0)
+{
+    assert(es.size() == n*n);
+    es.copyTo(edges);
+    perm.growTo(n, 0);
+    used.growTo(n, 0);
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < j; i++){
+            Var v = var(edge(i, j));
+            assert(edge(i, j) == edge(j, i));
+            in_clause.growTo(v+1, 0);
+            if (!in_clause[v]){
+                in_clause[v] = 1;
+                vars.push(v); }
+        }
+    for (int i = 0; i < vars.size(); i++)
+        in_clause[vars[i]] = 0;
+
+    uint64_t seed = 0;
+    zobrist.growTo(2*in_clause.size(), 0);
+    for (int i = 0; i < vars.size(); i++){
+        zobrist[toInt( mkLit(vars[i]))] = splitmix64(seed);
+        zobrist[toInt(~mkLit(vars[i]))] = splitmix64(seed); }
+    if (cache_bits > 0)
+        cache.growTo(1 << cache_bits, 0);
+}
+
+
+void CanonPropagator::attach(Solver& S)
+{
+    for (int i = 0; i < vars.size(); i++){
+        S.watchLit( mkLit(vars[i]), this);
+        S.watchLit(~mkLit(vars[i]), this); }
+    S.addPropagator(this);
+}
+
+
+bool CanonPropagator::propagate(Solver&, Lit p, vec<Lit>&)
+{
+    hash ^= zobrist[toInt(p)];
+    assigned.push(p);
+    dirty = true;
+    return true;
+}
+
+
+void CanonPropagator::backtrack(Solver& S, int)
+{
+    while (assigned.size() > 0 && S.value(assigned.last()) == l_Undef){
+        hash ^= zobrist[toInt(assigned.last())];
+        assigned.pop(); }
+}
+
+
+bool CanonPropagator::fixpoint(Solver& S, vec<Lit>& out_conflict)
+{
+    if (!dirty) return true;
+
+    bool complete = true;
+    for (int i = 0; complete && i < vars.size(); i++)
+        complete = S.value(vars[i]) != l_Undef;
+    if (!complete && ++skipped < freq)
+        return true;
+    skipped = 0;
+    dirty   = false;
+
+    uint64_t* entry = NULL;
+    if (!complete && cache.size() > 0 && hash != 0){
+        entry = &cache[hash & (cache.size() - 1)];
+        if (*entry == hash){
+            cache_hits++;
+            return true; }
+    }
+    checks++;
+
+    for (int i = 0; i < clause.size(); i++)
+        in_clause[var(clause[i])] = 0;
+    clause.clear();
+    nodes      = 0;
+    node_limit = complete ? -1 : cutoff;
+
+    int result = tryRefuters(S);
+    if (result == Equal){
+        for (int v = 0; v < n; v++)
+            used[v] = 0;
+        result = search(S, 0);
+        if (result == Witness || result == Implied)
+            addRefuter(-1);
+        else if (result == Equal && entry != NULL)
+            *entry = hash;
+    }
+    S.ticks += nodes;
+
+    if (result == Witness){
+        conflicts++;
+        clause.copyTo(out_conflict);
+        return false;
+    }else if (result == Implied){
+        propagations++;
+        S.enqueueLazy(clause[0], this);
+    }else if (result == Aborted)
+        aborted++;
+
+    return true;
+}
+
+
+// Map vertex 'k' to each unused vertex in turn, and go deeper while the columns are equal:
+int CanonPropagator::search(Solver& S, int k)
+{
+    if (k == n){
+        jump = 0;
+        while (jump < n && perm[jump] == jump)
+            jump++;
+        return jump == n ? Equal : Automorphism; }
+
+    for (int v = 0; v < n; v++){
+        if (used[v]) continue;
+        if (node_limit >= 0 && nodes >= node_limit)
+            return Aborted;
+        nodes++;
+
+        perm[k] = v;
+        used[v] = 1;
+        int mark   = clause.size();
+        int result = compare(S, k);
+        if (result == Equal)
+            result = search(S, k+1);
+        if (result == Automorphism && k == jump)
+            result = Pruned;
+        if (result != Equal && result != Pruned && result != Automorphism)
+            return result;
+
+        for (int i = mark; i < clause.size(); i++)
+            in_clause[var(clause[i])] = 0;
+        clause.shrink(clause.size() - mark);
+        used[v] = 0;
+        if (result == Automorphism)
+            return Automorphism;
+    }
+    return Equal;
+}
+
+
+// Compare the graph with its permutations by the recent refuters:
+int CanonPropagator::tryRefuters(Solver& S)
+{
+    for (int r = 0; r < refuters.size() / n; r++){
+        for (int k = 0; k < n; k++)
+            perm[k] = refuters[r*n + k];
+        nodes += n;
+
+        int result = Equal;
+        for (int k = 0; k < n && result == Equal; k++)
+            result = compare(S, k);
+        if (result == Witness || result == Implied){
+            refuter_hits++;
+            addRefuter(r);
+            return result; }
+
+        for (int i = 0; i < clause.size(); i++)
+            in_clause[var(clause[i])] = 0;
+        clause.clear();
+    }
+    return Equal;
+}
+
+
+void CanonPropagator::addRefuter(int r)
+{
+    if (r == -1){
+        // The search stopped with a prefix of 'perm' (the vertices in 'used'); complete it:
+        int k = 0;
+        for (int v = 0; v < n; v++)
+            k += used[v];
+        for (int v = 0; v < n; v++)
+            if (!used[v]) perm[k++] = v;
+
+        if (refuters.size() < max_refuters * n)
+            refuters.growTo(refuters.size() + n);
+        r = refuters.size() / n - 1; }
+    for (int i = r*n - 1; i >= 0; i--)
+        refuters[i + n] = refuters[i];
+    for (int k = 0; k < n; k++)
+        refuters[k] = perm[k];
+}
+
+
+// Compare column 'k' of the graph with column 'k' of the graph permuted by 'perm':
+int CanonPropagator::compare(Solver& S, int k)
+{
+    for (int i = 0; i < k; i++){
+        Lit   a  = edge(i, k);
+        Lit   b  = edge(perm[i], perm[k]);
+        if (a == b) continue;
+        lbool va = S.value(a);
+        lbool vb = S.value(b);
+
+        if (va != l_Undef && va == vb){
+            addFalse(S, a);
+            addFalse(S, b);
+        }else if (va == l_True && vb == l_False){
+            addFalse(S, a);
+            addFalse(S, b);
+            return Witness;
+        }else if (va == l_Undef && vb == l_False){
+            addFalse(S, b);
+            clause.push(~a);
+            Lit tmp = clause[0]; clause[0] = clause.last(); clause.last() = tmp;
+            return Implied;
+        }else if (va == l_True && vb == l_Undef){
+            addFalse(S, a);
+            clause.push(b);
+            Lit tmp = clause[0]; clause[0] = clause.last(); clause.last() = tmp;
+            return Implied;
+        }else
+            return Pruned;
+    }
+    return Equal;
+}
+
+
+// Add the literal of 'p' that is false (once):
+void CanonPropagator::addFalse(Solver& S, Lit p)
+{
+    Lit f = S.value(p) == l_True ? ~p : p;
+    if (!in_clause[var(f)]){
+        in_clause[var(f)] = 1;
+        clause.push(f); }
+}
+
+
+// Reasons are explained as soon as a literal is implied ('permanent()'), so the clause of the last
+// check is still there:
+void CanonPropagator::explain(Solver&, Lit p, vec<Lit>& out_reason)
+{
+    assert(clause.size() > 0 && clause[0] == p);
+    for (int i = 0; i < clause.size(); i++)
+        out_reason.push(clause[i]);
+}
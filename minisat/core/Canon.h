@@ -0,0 +1,101 @@
+/*****************************************************************************************[Canon.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Canon_h
+#define Minisat_Canon_h
+
+#include "minisat/mtl/Vec.h"
+#include "minisat/core/Propagator.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// CanonPropagator -- restricts an undirected graph to the canonical member of its isomorphism class:
+//
+// The graph on 'n' vertices is given by the literals of its adjacency matrix. Its entries above the
+// diagonal are compared column by column, (0,1), (0,2), (1,2), (0,3), ..., and the graph must be
+// lexicographically smallest (false < true) under all vertex permutations. The permutations are
+// searched vertex by vertex, so that a column can be compared as soon as its vertex is mapped:
+// a branch is pruned once the permuted graph is not smaller or the comparison is undetermined.
+// A permutation that makes the graph smaller is a conflict, one that needs a single unassigned
+// entry to stay equal implies it. Both are kept as clauses. The first permutation reaching the end
+// is the identity; any other one keeps the graph equal, so it is an automorphism, and the branch
+// where it first deviates from the identity is equivalent to the branch of the identity, which was
+// searched before: the search goes back to it. Checks of partial graphs are limited to 'cutoff'
+// search nodes and only run at every 'freq'-th fixpoint; complete graphs are always checked
+// exactly.
+//
+// The permutations that refuted recent graphs are tried first, before searching. A search that
+// ends within the cutoff without finding anything has ruled out all permutations, so such partial
+// graphs are remembered by a Zobrist hash of the assigned edges (updated as the propagator is
+// notified and backtracks) in a table of '2^cache_bits' entries. Aborted checks are not remembered:
+// the refuters tried first change, and may refute the same partial graph later.
+
+class CanonPropagator : public Propagator {
+public:
+    CanonPropagator(int n, const vec<Lit>& edges, int cutoff, int freq, int cache_bits); // 'edges[i*n+j]': the edge between 'i' and 'j'.
+
+    void     attach   (Solver& S);
+
+    bool     propagate(Solver& S, Lit p, vec<Lit>& out_conflict);
+    bool     fixpoint (Solver& S, vec<Lit>& out_conflict);
+    void     explain  (Solver& S, Lit p, vec<Lit>& out_reason);
+    void     backtrack(Solver& S, int level);
+    bool     permanent() const { return true; }
+
+    // Statistics:
+    //
+    uint64_t checks, aborted, propagations, conflicts, cache_hits, refuter_hits;
+
+protected:
+    enum { Equal, Pruned, Witness, Implied, Aborted, Automorphism }; // Outcomes of comparing a column or searching.
+    enum { max_refuters = 16 };
+
+    int           n;
+    vec<Lit>      edges;
+    vec<Var>      vars;           // The distinct variables of 'edges'.
+    int           cutoff;
+    int           freq;
+    bool          dirty;          // An edge was assigned since the last check.
+    int           skipped;        // Fixpoints skipped since the last check.
+
+    vec<int>      perm;           // The permutation searched for ('perm[k]' for the first vertices 'k').
+    vec<char>     used;           // Vertices in the image of 'perm'.
+    vec<Lit>      clause;         // The false literals of the comparison so far (an implied literal first).
+    vec<char>     in_clause;
+    int           jump;           // The vertex at which the last automorphism found deviates from the identity.
+    int64_t       nodes;
+    int64_t       node_limit;     // Negative if unlimited.
+
+    vec<uint64_t> zobrist;        // Random key of each edge literal ('toInt()').
+    uint64_t      hash;           // XOR of the keys of the literals in 'assigned',
+    vec<Lit>      assigned;       // the edge literals notified about, in trail order.
+    vec<uint64_t> cache;          // Hashes of partial graphs whose check found nothing (0 = empty).
+    vec<int>      refuters;       // Recently refuting permutations, 'n' each, most recent first.
+
+    Lit      edge     (int i, int j) const { return edges[i*n + j]; }
+    int      search   (Solver& S, int k);
+    int      compare  (Solver& S, int k);
+    int      tryRefuters(Solver& S);
+    void     addRefuter(int i);   // Move refuter 'i' (or 'perm' if -1) to the front.
+    void     addFalse (Solver& S, Lit p);
+};
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*****************************************************************************************[Card.cc]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#include "minisat/core/Card.h"
+#include "minisat/core/Solver.h"
+
+using namespace Minisat;
+
+
+CardPropagator::CardPropagator() : propagations(0), conflicts(0) {}
+
+
+void CardPropagator::addAtMost(Solver& S, const vec<Lit>& ls, int k)
+{
+    assert(k > 0 && k < ls.size());
+    Card c = { lits.size(), ls.size(), k, 0 };
+    for (int i = 0; i < ls.size(); i++){
+        Lit p = ls[i];
+        assert(S.value(p) == l_Undef);
+        lits.push(p);
+        occs.growTo(2*(var(p)+1));
+        if (occs[toInt(p)].size() == 0)
+            S.watchLit(p, this);
+        occs[toInt(p)].push(cards.size());
+        reason_card.growTo(var(p)+1, -1);
+    }
+    cards.push(c);
+}
+
+
+bool CardPropagator::propagate(Solver& S, Lit p, vec<Lit>& out_conflict)
+{
+    const vec<int>& cs = occs[toInt(p)];
+    counted.push(p);
+
+    // Count 'p' everywhere first, so that backtracking can undo it the same way:
+    bool conflict = false;
+    for (int i = 0; i < cs.size(); i++)
+        if (++cards[cs[i]].count > cards[cs[i]].k && !conflict){
+            conflict = true;
+            conflicts++;
+            trueLits(S, cards[cs[i]], out_conflict); }
+    if (conflict) return false;
+
+    for (int i = 0; i < cs.size(); i++){
+        const Card& c = cards[cs[i]];
+        if (c.count < c.k) continue;
+
+        S.ticks += c.size;
+        for (int j = c.start; j < c.start + c.size; j++)
+            if (S.value(lits[j]) == l_Undef){
+                reason_card[var(lits[j])] = cs[i];
+                S.enqueueLazy(~lits[j], this);
+                propagations++; }
+    }
+    return true;
+}
+
+
+void CardPropagator::trueLits(Solver& S, const Card& c, vec<Lit>& out)
+{
+    for (int j = c.start; j < c.start + c.size; j++)
+        if (S.value(lits[j]) == l_True)
+            out.push(~lits[j]);
+}
+
+
+// Literals of the constraint can not become true after the remaining ones were implied false, so
+// its true literals now are the ones that implied 'p':
+void CardPropagator::explain(Solver& S, Lit p, vec<Lit>& out_reason)
+{
+    assert(reason_card[var(p)] != -1);
+    out_reason.push(p);
+    trueLits(S, cards[reason_card[var(p)]], out_reason);
+}
+
+
+void CardPropagator::backtrack(Solver& S, int)
+{
+    while (counted.size() > 0 && S.value(counted.last()) == l_Undef){
+        const vec<int>& cs = occs[toInt(counted.last())];
+        for (int i = 0; i < cs.size(); i++)
+            cards[cs[i]].count--;
+        counted.pop();
+    }
+}
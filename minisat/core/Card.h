@@ -0,0 +1,64 @@
+/******************************************************************************************[Card.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Card_h
+#define Minisat_Card_h
+
+#include "minisat/mtl/Vec.h"
+#include "minisat/core/Propagator.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// CardPropagator -- at-most-k constraints over literals:
+//
+// Every constraint counts its literals that the propagator was notified of being true. Once the
+// count reaches 'k', the remaining unassigned literals are implied false, with the true literals
+// of the constraint as the reason; beyond 'k' the true literals are a conflict. The counts are
+// undone in the order they were made when backtracking.
+
+class CardPropagator : public Propagator {
+public:
+    CardPropagator();
+
+    void     addAtMost(Solver& S, const vec<Lit>& lits, int k); // Literals must be unassigned and distinct, with 0 < k < lits.size().
+    int      nConstraints() const { return cards.size(); }
+
+    bool     propagate(Solver& S, Lit p, vec<Lit>& out_conflict);
+    void     explain  (Solver& S, Lit p, vec<Lit>& out_reason);
+    void     backtrack(Solver& S, int level);
+
+    // Statistics:
+    //
+    uint64_t propagations, conflicts;
+
+protected:
+    struct Card { int start, size, k, count; };
+
+    vec<Card>       cards;
+    vec<Lit>        lits;           // Literals of all constraints ('start' and 'size' index into this).
+    vec<vec<int> >  occs;           // 'occs[toInt(p)]': the constraints containing 'p'.
+    vec<int>        reason_card;    // Constraint that implied each variable (if it did).
+    vec<Lit>        counted;        // Literals counted as true, in trail order.
+
+    void     trueLits (Solver& S, const Card& c, vec<Lit>& out); // Add the negations of the true literals of 'c' to 'out'.
+};
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,156 @@
+/**************************************************************************************[Connect.cc]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#include "minisat/core/Connect.h"
+#include "minisat/core/Solver.h"
+
+using namespace Minisat;
+
+
+ConnectPropagator::ConnectPropagator(int n_, const vec<Lit>& es) :
+    checks(0), propagations(0), conflicts(0), n(n_), dirty(true)
+{
+    assert(es.size() == n*n);
+    adj.growTo(n);
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < j; i++){
+            Lit e = es[i*n + j];
+            assert(e == es[j*n + i]);
+            if (e == lit_Undef) continue;
+            adj[i].push(lits.size());
+            adj[j].push(lits.size());
+            lits.push(e);
+            from.push(i);
+            to  .push(j);
+            implied_by.growTo(var(e)+1, -1);
+        }
+    reason_start.growTo(lits.size(), 0);
+    reason_size .growTo(lits.size(), 0);
+    pre   .growTo(n);
+    low   .growTo(n);
+    size  .growTo(n);
+    parent.growTo(n);
+    iter  .growTo(n);
+}
+
+
+void ConnectPropagator::attach(Solver& S)
+{
+    for (int e = 0; e < lits.size(); e++)
+        S.watchLit(~lits[e], this);
+    S.addPropagator(this);
+}
+
+
+bool ConnectPropagator::propagate(Solver&, Lit, vec<Lit>&)
+{
+    dirty = true;
+    return true;
+}
+
+
+void ConnectPropagator::backtrack(Solver& S, int)
+{
+    while (implied.size() > 0 && S.value(lits[implied.last()]) == l_Undef){
+        reasons.shrink(reasons.size() - reason_start[implied.last()]);
+        implied.pop(); }
+}
+
+
+bool ConnectPropagator::fixpoint(Solver& S, vec<Lit>& out_conflict)
+{
+    if (!dirty || n == 0) return true;
+    dirty = false;
+    checks++;
+
+    // Depth-first search from vertex 0 over the edges that are not false:
+    for (int v = 0; v < n; v++)
+        pre[v] = -1;
+    order.clear();
+    stack.clear();
+    pre[0] = low[0] = 0;
+    parent[0] = -1;
+    iter[0]   = 0;
+    order.push(0);
+    stack.push(0);
+    while (stack.size() > 0){
+        int v = stack.last();
+        if (iter[v] < adj[v].size()){
+            int e = adj[v][iter[v]++];
+            S.ticks++;
+            if (e == parent[v] || S.value(lits[e]) == l_False) continue;
+            int w = other(e, v);
+            if (pre[w] == -1){
+                pre[w] = low[w] = order.size();
+                parent[w] = e;
+                iter[w]   = 0;
+                order.push(w);
+                stack.push(w);
+            }else if (pre[w] < low[v])
+                low[v] = pre[w];
+        }else{
+            stack.pop();
+            size[v] = order.size() - pre[v];
+            if (parent[v] != -1){
+                int u = other(parent[v], v);
+                if (low[v] < low[u]) low[u] = low[v]; }
+        }
+    }
+
+    if (order.size() < n){
+        conflicts++;
+        cutEdges(0, order.size(), -1, out_conflict);
+        return false; }
+
+    // Imply the unassigned bridges:
+    for (int k = 1; k < n; k++){
+        int v = order[k], e = parent[v];
+        if (low[v] < pre[v] || S.value(lits[e]) != l_Undef) continue;
+        reason_start[e] = reasons.size();
+        cutEdges(pre[v], pre[v] + size[v], e, reasons);
+        reason_size[e]  = reasons.size() - reason_start[e];
+        implied.push(e);
+        implied_by[var(lits[e])] = e;
+        S.enqueueLazy(lits[e], this);
+        propagations++;
+    }
+    return true;
+}
+
+
+// Add the edges leaving the vertices with preorder numbers in '[lo, hi)', except 'skip', to 'out':
+void ConnectPropagator::cutEdges(int lo, int hi, int skip, vec<Lit>& out) const
+{
+    for (int k = lo; k < hi; k++){
+        int v = order[k];
+        for (int i = 0; i < adj[v].size(); i++){
+            int e = adj[v][i], w = other(e, v);
+            if (e != skip && (pre[w] < lo || pre[w] >= hi))
+                out.push(lits[e]);
+        }
+    }
+}
+
+
+void ConnectPropagator::explain(Solver&, Lit p, vec<Lit>& out_reason)
+{
+    int e = implied_by[var(p)];
+    assert(lits[e] == p);
+    out_reason.push(p);
+    for (int i = reason_start[e]; i < reason_start[e] + reason_size[e]; i++)
+        out_reason.push(reasons[i]);
+}
@@ -0,0 +1,78 @@
+/***************************************************************************************[Connect.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Connect_h
+#define Minisat_Connect_h
+
+#include "minisat/mtl/Vec.h"
+#include "minisat/core/Propagator.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// ConnectPropagator -- requires an undirected graph to be connected:
+//
+// The graph on 'n' vertices is given by the literals of its adjacency matrix, where 'lit_Undef'
+// marks pairs that are never adjacent. Once an edge became false, a depth-first search over the
+// edges that are not false checks that it still reaches all vertices, and finds its bridges by
+// low-links. If the search is stuck, the edges leaving the reached vertices (all false) are a
+// conflict: one of them must be true. An unassigned bridge is implied, with the other (false)
+// edges leaving the subtree below it as the reason.
+
+class ConnectPropagator : public Propagator {
+public:
+    ConnectPropagator(int n, const vec<Lit>& edges); // 'edges[i*n+j]': the edge between 'i' and 'j'.
+
+    void     attach   (Solver& S);
+
+    bool     propagate(Solver& S, Lit p, vec<Lit>& out_conflict);
+    bool     fixpoint (Solver& S, vec<Lit>& out_conflict);
+    void     explain  (Solver& S, Lit p, vec<Lit>& out_reason);
+    void     backtrack(Solver& S, int level);
+
+    // Statistics:
+    //
+    uint64_t checks, propagations, conflicts;
+
+protected:
+    int             n;
+    vec<Lit>        lits;           // The literal and endpoints of each edge.
+    vec<int>        from, to;
+    vec<vec<int> >  adj;            // The edges of each vertex.
+    bool            dirty;          // An edge became false since the last check (backtracking cannot disconnect the graph).
+
+    vec<int>        pre;            // Preorder number of each vertex in the search (-1 if not reached),
+    vec<int>        low;            // its low-link,
+    vec<int>        size;           // the size of its subtree,
+    vec<int>        parent;         // and the edge it was reached by.
+    vec<int>        order;          // The vertices in preorder.
+    vec<int>        stack, iter;
+
+    vec<Lit>        reasons;        // Reasons of the implied edges (without them), in trail order,
+    vec<int>        reason_start;   // where the reason of each edge starts, and its size,
+    vec<int>        reason_size;
+    vec<int>        implied;        // the implied edges,
+    vec<int>        implied_by;     // and the edge that implied each variable (edges may share variables).
+
+    int      other    (int e, int v) const { return from[e] == v ? to[e] : from[e]; }
+    void     cutEdges (int lo, int hi, int skip, vec<Lit>& out) const;
+};
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,60 @@
+/*************************************************************************************[External.cc]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#include "minisat/core/External.h"
+#include "minisat/core/Solver.h"
+
+using namespace Minisat;
+
+
+ExternalPropagator::ExternalPropagator(ExplainFn explain, void* d) :
+    implied(0), explained(0), explain_fn(explain), data(d), reason(NULL) {}
+
+
+void ExternalPropagator::setCallback(ExplainFn explain, void* d)
+{
+    explain_fn = explain;
+    data       = d;
+}
+
+
+bool ExternalPropagator::imply(Solver& S, Lit p)
+{
+    if (S.value(p) == l_Undef) implied++;
+    return S.enqueueLazy(p, this);
+}
+
+
+void ExternalPropagator::addReason(Lit q)
+{
+    assert(reason != NULL);
+    reason->push(q);
+}
+
+
+void ExternalPropagator::explain(Solver& S, Lit p, vec<Lit>& out_reason)
+{
+    explained++;
+    out_reason.push(p);
+    reason = &out_reason;
+    explain_fn(data, S.l2i(p));
+    reason = NULL;
+#ifndef NDEBUG
+    for (int i = 1; i < out_reason.size(); i++)
+        assert(S.value(out_reason[i]) == l_False);
+#endif
+}
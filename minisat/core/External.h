@@ -0,0 +1,61 @@
+/**************************************************************************************[External.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_External_h
+#define Minisat_External_h
+
+#include "minisat/mtl/Vec.h"
+#include "minisat/core/Propagator.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// ExternalPropagator -- implications made through the C interface with lazy explanations:
+//
+// A literal implied with 'imply()' gets no reason clause. Only when conflict analysis needs one is
+// the callback asked for it (with the implied literal, in DIMACS numbering); it adds the other, false
+// literals of the reason one by one with 'addReason()'. As for all propagators that are not
+// permanent, the clause is freed again by backtracking, and explanations never asked for cost
+// nothing.
+
+class ExternalPropagator : public Propagator {
+public:
+    typedef void (*ExplainFn)(void* data, int lit);
+
+    ExternalPropagator(ExplainFn explain, void* data);
+
+    void     setCallback(ExplainFn explain, void* data); // Also explains the literals implied before.
+    bool     imply    (Solver& S, Lit p);        // FALSE if 'p' is false.
+    void     addReason(Lit q);                   // Only while explaining.
+
+    bool     propagate(Solver&, Lit, vec<Lit>&) { return true; } // (Watches no literals.)
+    void     explain  (Solver& S, Lit p, vec<Lit>& out_reason);
+
+    // Statistics:
+    //
+    uint64_t implied, explained;
+
+protected:
+    ExplainFn       explain_fn;
+    void*           data;
+    vec<Lit>*       reason;      // The reason being explained (NULL otherwise).
+};
+
+//=================================================================================================
+}
+
+#endif
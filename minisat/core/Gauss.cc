@@ -0,0 +1,224 @@
+/****************************************************************************************[Gauss.cc]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#include "minisat/core/Gauss.h"
+#include "minisat/core/Solver.h"
+
+using namespace Minisat;
+
+static inline bool parity(uint64_t x){
+    x ^= x >> 32; x ^= x >> 16; x ^= x >> 8; x ^= x >> 4; x ^= x >> 2; x ^= x >> 1;
+    return x & 1; }
+
+
+GaussPropagator::GaussPropagator() :
+    eliminations(0), propagations(0), conflicts(0), nrows(0), words(0), dirty(true)
+{}
+
+
+void GaussPropagator::addXor(const vec<Var>& vs, bool rhs)
+{
+    assert(words == 0);
+    xor_start.push(xor_vars.size());
+    for (int i = 0; i < vs.size(); i++)
+        xor_vars.push(vs[i]);
+    xor_rhs.push(rhs);
+}
+
+
+void GaussPropagator::attach(Solver& S)
+{
+    assert(words == 0);
+    xor_start.push(xor_vars.size());
+    nrows = xor_rhs.size();
+
+    for (int i = 0; i < xor_vars.size(); i++){
+        Var v = xor_vars[i];
+        col_of.growTo(v+1, -1);
+        if (col_of[v] == -1){
+            col_of[v] = cols.size();
+            cols.push(v); }
+    }
+    words = (cols.size() >> 6) + 1;
+
+    mat.growTo(nrows * words, 0);
+    for (int r = 0; r < nrows; r++){
+        uint64_t* rw = row(mat, r);
+        for (int i = xor_start[r]; i < xor_start[r+1]; i++){
+            int c = col_of[xor_vars[i]];
+            rw[c >> 6] ^= (uint64_t)1 << (c & 63); }
+        if (xor_rhs[r])
+            rw[cols.size() >> 6] |= (uint64_t)1 << (cols.size() & 63);
+    }
+    xor_vars.clear(true);
+    xor_start.clear(true);
+    xor_rhs.clear(true);
+
+    unassigned.growTo(words);
+    true_cols .growTo(words);
+    reason_of .growTo(cols.size(), -1);
+
+    // Initial reduction over all columns (a row without a column left is checked by 'fixpoint()'):
+    basic    .growTo(nrows, -1);
+    basic_row.growTo(cols.size(), -1);
+    for (int w = 0; w < words; w++)
+        unassigned[w] = ~(uint64_t)0;
+    unassigned[cols.size() >> 6] &= ((uint64_t)1 << (cols.size() & 63)) - 1;
+    for (int r = 0; r < nrows; r++){
+        int c = firstCol(row(mat, r), unassigned);
+        if (c != -1) pivot(S, r, c); }
+
+    for (int c = 0; c < cols.size(); c++){
+        S.watchLit( mkLit(cols[c]), this);
+        S.watchLit(~mkLit(cols[c]), this); }
+    S.addPropagator(this);
+}
+
+
+bool GaussPropagator::propagate(Solver&, Lit p, vec<Lit>&)
+{
+    // Columns implied by the matrix itself were already accounted for:
+    if (reason_of[col_of[var(p)]] == -1)
+        dirty = true;
+    return true;
+}
+
+
+int GaussPropagator::firstCol(const uint64_t* r, const vec<uint64_t>& mask) const
+{
+    for (int k = 0; k < words; k++){
+        uint64_t u = r[k] & mask[k];
+        if (u != 0){
+            int c = k << 6;
+            while ((u & 1) == 0) u >>= 1, c++;
+            return c; }
+    }
+    return -1;
+}
+
+
+void GaussPropagator::pivot(Solver& S, int r, int c)
+{
+    if (basic[r] != -1)
+        basic_row[basic[r]] = -1;
+    basic[r]     = c;
+    basic_row[c] = r;
+
+    const uint64_t* pr  = row(mat, r);
+    uint64_t        bit = (uint64_t)1 << (c & 63);
+    for (int r2 = 0; r2 < nrows; r2++){
+        uint64_t* rr = row(mat, r2);
+        if (r2 != r && (rr[c >> 6] & bit) != 0)
+            for (int k = 0; k < words; k++)
+                rr[k] ^= pr[k];
+    }
+    S.ticks += nrows;
+}
+
+
+bool GaussPropagator::fixpoint(Solver& S, vec<Lit>& out_conflict)
+{
+    if (!dirty) return true;
+    dirty = false;
+    eliminations++;
+
+    for (int w = 0; w < words; w++)
+        unassigned[w] = true_cols[w] = 0;
+    for (int c = 0; c < cols.size(); c++){
+        lbool    val = S.value(cols[c]);
+        uint64_t bit = (uint64_t)1 << (c & 63);
+        if      (val == l_Undef) unassigned[c >> 6] |= bit;
+        else if (val == l_True)  true_cols [c >> 6] |= bit;
+    }
+
+    // Move the basic column of each row to an unassigned one. The other basic columns do not occur
+    // in the row, so this keeps the basic columns of the rows pivoted before:
+    S.ticks += nrows;
+    for (int r = 0; r < nrows; r++)
+        if (basic[r] == -1 || S.value(cols[basic[r]]) != l_Undef){
+            int c = firstCol(row(mat, r), unassigned);
+            if (c != -1) pivot(S, r, c); }
+
+    // The rows without an unassigned basic column have no unassigned column left; check their parity:
+    for (int r = 0; r < nrows; r++){
+        if (basic[r] != -1 && S.value(cols[basic[r]]) == l_Undef) continue;
+        const uint64_t* rw = row(mat, r);
+        bool            p  = false;
+        for (int k = 0; k < words; k++)
+            p ^= parity(rw[k] & true_cols[k]);
+        if (p != rhs(rw)){
+            conflicts++;
+            rowClause(S, rw, -1, out_conflict);
+            return false; }
+    }
+
+    // The rows whose basic column is the only unassigned one imply it (this affects no other row):
+    for (int r = 0; r < nrows; r++){
+        int col = basic[r];
+        if (col == -1 || S.value(cols[col]) != l_Undef) continue;
+
+        const uint64_t* rw   = row(mat, r);
+        bool            only = true;
+        bool            p    = false;
+        for (int k = 0; k < words; k++){
+            uint64_t u = rw[k] & unassigned[k];
+            if (k == (col >> 6)) u &= ~((uint64_t)1 << (col & 63));
+            if (u != 0){ only = false; break; }
+            p ^= parity(rw[k] & true_cols[k]);
+        }
+        if (!only) continue;
+
+        // Keep the row as the reason:
+        reason_of[col] = reason_cols.size();
+        reason_cols.push(col);
+        for (int k = 0; k < words; k++)
+            reason_rows.push(rw[k]);
+
+        propagations++;
+        bool ok = S.enqueueLazy(mkLit(cols[col], p == rhs(rw)), this);
+        assert(ok); (void)ok;
+    }
+
+    return true;
+}
+
+
+void GaussPropagator::rowClause(Solver& S, const uint64_t* r, int skip, vec<Lit>& out)
+{
+    for (int c = 0; c < cols.size(); c++)
+        if (c != skip && ((r[c >> 6] >> (c & 63)) & 1))
+            out.push(mkLit(cols[c], S.value(cols[c]) == l_True));
+}
+
+
+void GaussPropagator::explain(Solver& S, Lit p, vec<Lit>& out_reason)
+{
+    int col = col_of[var(p)];
+    assert(reason_of[col] != -1);
+    out_reason.push(p);
+    rowClause(S, &reason_rows[reason_of[col] * words], col, out_reason);
+}
+
+
+void GaussPropagator::backtrack(Solver& S, int)
+{
+    while (reason_cols.size() > 0 && S.value(cols[reason_cols.last()]) == l_Undef){
+        reason_of[reason_cols.last()] = -1;
+        reason_cols.pop();
+        reason_rows.shrink(words);
+    }
+}
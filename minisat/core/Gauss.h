@@ -0,0 +1,89 @@
+/*****************************************************************************************[Gauss.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Gauss_h
+#define Minisat_Gauss_h
+
+#include "minisat/mtl/Vec.h"
+#include "minisat/core/Propagator.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// GaussPropagator -- a system of XOR constraints propagated by Gauss-Jordan elimination:
+//
+// Rows are bit-packed over the columns (the variables of the system), with the right-hand side as
+// one extra column. The matrix is kept reduced: each row has a basic column occurring in no other
+// row. Whenever a variable of the system was assigned, the next fixpoint moves the basic column of
+// each row whose basic variable is assigned to an unassigned column of the row, if it has one
+// (eliminating it from the other rows). The matrix is then in reduced form over the unassigned
+// columns: a row with no unassigned column is a conflict if its parity is wrong, a row whose only
+// unassigned column is its basic one implies it. The reason is the row itself, which is kept until
+// the implied literal is unassigned. Backtracking leaves the matrix as it is (all rows are sums of
+// the original constraints), so a fixpoint costs a pass over the rows and one pass per new pivot,
+// 'O(nRows() * nCols() / 64)' words each.
+
+class GaussPropagator : public Propagator {
+public:
+    GaussPropagator();
+
+    void     addXor   (const vec<Var>& vs, bool rhs); // Add the constraint that the sum of 'vs' modulo 2 is 'rhs'.
+    void     attach   (Solver& S);                    // Build the matrix and start propagating (no more 'addXor()').
+
+    int      nRows    () const { return nrows; }
+    int      nCols    () const { return cols.size(); }
+
+    bool     propagate(Solver& S, Lit p, vec<Lit>& out_conflict);
+    bool     fixpoint (Solver& S, vec<Lit>& out_conflict);
+    void     explain  (Solver& S, Lit p, vec<Lit>& out_reason);
+    void     backtrack(Solver& S, int level);
+
+    // Statistics:
+    //
+    uint64_t eliminations, propagations, conflicts;
+
+protected:
+    vec<Var>      xor_vars;       // The constraints given to 'addXor()': variables,
+    vec<int>      xor_start;      // start index into 'xor_vars',
+    vec<char>     xor_rhs;        // and right-hand side.
+
+    vec<Var>      cols;           // Variable of each column.
+    vec<int>      col_of;         // Column of each variable (-1 if not in the system).
+    int           nrows;
+    int           words;          // Words per row (the right-hand side is column 'cols.size()').
+    vec<uint64_t> mat;            // The reduced constraints, 'words' per row.
+    vec<int>      basic;          // Basic column of each row (-1 if the row has no column left).
+    vec<int>      basic_row;      // Row of each column if it is basic (-1 otherwise).
+    vec<uint64_t> unassigned;     // Columns that are unassigned,
+    vec<uint64_t> true_cols;      // and columns that are true in the current assignment.
+    bool          dirty;          // A column was assigned since the last elimination.
+
+    vec<uint64_t> reason_rows;    // Rows that implied the literals on the trail, 'words' each,
+    vec<int>      reason_cols;    // the implied column of each,
+    vec<int>      reason_of;      // and the index into them for each column (-1 if not implied here).
+
+    uint64_t* row     (vec<uint64_t>& m, int r) { return &m[r * words]; }
+    int       firstCol(const uint64_t* r, const vec<uint64_t>& mask) const;   // First column of row 'r' in 'mask' (-1 if none).
+    void      pivot   (Solver& S, int r, int c);                           // Make 'c' the basic column of row 'r'.
+    bool      rhs     (const uint64_t* r) const { return (r[cols.size() >> 6] >> (cols.size() & 63)) & 1; }
+    void      rowClause(Solver& S, const uint64_t* r, int skip, vec<Lit>& out);
+};
+
+//=================================================================================================
+}
+
+#endif
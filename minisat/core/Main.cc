@@ -23,6 +23,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "minisat/utils/System.h"
 #include "minisat/utils/Options.h"
 #include "minisat/core/Dimacs.h"
+#include "minisat/core/Opb.h"
 #include "minisat/core/Solver.h"
 
 using namespace Minisat;
@@ -46,6 +47,28 @@ static void SIGINT_exit(int) {
     _exit(1); }
 
 
+// The adjacency matrix of a graph on 'n' vertices whose edges are the first variables, row by row:
+static void graphEdges(Solver& S, int n, vec<Lit>& edges)
+{
+    edges.growTo(n * n, lit_Undef);
+    for (int i = 0, v = 0; i < n; i++)
+        for (int j = i+1; j < n; j++, v++){
+            while (v >= S.nVars()) S.newVar();
+            edges[i*n + j] = edges[j*n + i] = mkLit(v); }
+}
+
+
+// The same for a directed graph, whose arcs 'i -> j' (for 'i != j') are the first variables:
+static void graphArcs(Solver& S, int n, vec<Lit>& arcs)
+{
+    arcs.growTo(n * n, lit_Undef);
+    for (int i = 0, v = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            if (i != j){
+                while (v >= S.nVars()) S.newVar();
+                arcs[i*n + j] = mkLit(v++); }
+}
+
 //=================================================================================================
 // Main:
 
@@ -53,7 +76,7 @@ static void SIGINT_exit(int) {
 int main(int argc, char** argv)
 {
     try {
-        setUsageHelp("USAGE: %s [options] <input-file> <result-output-file>\n\n  where input may be either in plain or gzipped DIMACS.\n");
+        setUsageHelp("USAGE: %s [options] <input-file> <result-output-file>\n\n  where input may be either in plain or gzipped DIMACS (or OPB, with '-opb').\n");
         setX86FPUPrecision();
 
         // Extra options:
@@ -61,7 +84,13 @@ int main(int argc, char** argv)
         IntOption    verb   ("MAIN", "verb",   "Verbosity level (0=silent, 1=some, 2=more).", 1, IntRange(0, 2));
         IntOption    cpu_lim("MAIN", "cpu-lim","Limit on CPU time allowed in seconds.\n", 0, IntRange(0, INT32_MAX));
         IntOption    mem_lim("MAIN", "mem-lim","Limit on memory usage in megabytes.\n", 0, IntRange(0, INT32_MAX));
+        IntOption    wall_lim("MAIN", "wall-lim","Limit on wall-clock time allowed for simplification and solving (after parsing) in seconds.\n", 0, IntRange(0, INT32_MAX));
+        Int64Option  tick_lim("MAIN", "tick-lim","Limit on work in ticks (watcher and clause visits); reproducible across machines.\n", 0, Int64Range(0, INT64_MAX));
         BoolOption   strictp("MAIN", "strict", "Validate DIMACS header during parsing.", false);
+        BoolOption   opb    ("MAIN", "opb",    "Read the input as linear pseudo-Boolean constraints in OPB format.", false);
+        IntOption    canon  ("MAIN", "canon",  "Restrict the graph on this many vertices to canonical ones; its edges are variables 1, 2, ... row by row (0 = off).", 0, IntRange(0, INT32_MAX));
+        IntOption    connected("MAIN", "connected", "Require the graph on this many vertices to be connected; its edges are variables 1, 2, ... row by row (0 = off).", 0, IntRange(0, INT32_MAX));
+        IntOption    acyclic("MAIN", "acyclic", "Require the directed graph on this many vertices to be acyclic; its arcs are variables 1, 2, ... row by row (0 = off).", 0, IntRange(0, INT32_MAX));
         
         parseOptions(argc, argv, true);
 
@@ -78,6 +107,7 @@ int main(int argc, char** argv)
         // Try to set resource limits:
         if (cpu_lim != 0) limitTime(cpu_lim);
         if (mem_lim != 0) limitMemory(mem_lim);
+        if (tick_lim != 0) S.setTickBudget(tick_lim);
         
         if (argc == 1)
             printf("Reading from standard input... Use '--help' for help.\n");
@@ -90,8 +120,27 @@ int main(int argc, char** argv)
             printf("============================[ Problem Statistics ]=============================\n");
             printf("|                                                                             |\n"); }
         
-        parse_DIMACS(in, S, (bool)strictp);
+        if (opb)
+            parse_OPB(in, S);
+        else
+            parse_DIMACS(in, S, (bool)strictp);
+        if (canon > 0){
+            vec<Lit> edges;
+            graphEdges(S, canon, edges);
+            S.addCanonicity(canon, edges);
+        }
+        if (connected > 0){
+            vec<Lit> edges;
+            graphEdges(S, connected, edges);
+            S.addConnectivity(connected, edges);
+        }
+        if (acyclic > 0){
+            vec<Lit> arcs;
+            graphArcs(S, acyclic, arcs);
+            S.addAcyclicity(acyclic, arcs);
+        }
         gzclose(in);
+        if (wall_lim != 0) S.setTimeBudget(wall_lim);
         FILE* res = (argc >= 3) ? fopen(argv[2], "wb") : NULL;
         
         if (S.verbosity > 0){
@@ -114,6 +163,7 @@ int main(int argc, char** argv)
                 printf("Solved by unit propagation\n");
                 S.printStats();
                 printf("\n"); }
+            S.writeStats("solve", l_False);
             printf("UNSATISFIABLE\n");
             exit(20);
         }
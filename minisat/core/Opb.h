@@ -0,0 +1,107 @@
+/*******************************************************************************************[Opb.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Opb_h
+#define Minisat_Opb_h
+
+#include <stdio.h>
+
+#include "minisat/utils/ParseUtils.h"
+#include "minisat/core/SolverTypes.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// OPB Parser (linear pseudo-Boolean constraints, as in the PB competitions):
+//
+//   * #variable= 3 #constraint= 2
+//   +2 x1 -1 ~x2 +1 x3 >= 2 ;
+//   +1 x1 +1 x2 = 1 ;
+//
+// An objective function ('min: ... ;') is skipped; only satisfiability is decided.
+
+template<class B, class Solver>
+static void readPbTerms(B& in, Solver& S, vec<Lit>& lits, vec<int64_t>& coefs) {
+    lits.clear();
+    coefs.clear();
+    for (;;){
+        skipWhitespace(in);
+        if (*in == '>' || *in == '<' || *in == '=' || *in == ';') break;
+        coefs.push(parseInt64(in));
+        skipWhitespace(in);
+        bool sign = false;
+        if (*in == '~') sign = true, ++in;
+        if (*in != 'x') printf("PARSE ERROR! Unexpected char: %c\n", *in), exit(3);
+        ++in;
+        int var = parseInt(in) - 1;
+        if (var < 0) printf("PARSE ERROR! Variable index must be positive\n"), exit(3);
+        while (var >= S.nVars()) S.newVar();
+        lits.push(mkLit(var, sign));
+        skipWhitespace(in);
+        if (*in == '~' || *in == 'x')
+            printf("PARSE ERROR! Non-linear constraints are not supported\n"), exit(3);
+    }
+}
+
+template<class B, class Solver>
+static void parse_OPB_main(B& in, Solver& S) {
+    vec<Lit>     lits;
+    vec<int64_t> coefs;
+    for (;;){
+        skipWhitespace(in);
+        if (*in == EOF) break;
+        else if (*in == '*'){
+            if (eagerMatch(in, "* #variable=")){
+                int vars = parseInt(in);
+                while (S.nVars() < vars) S.newVar(); }
+            skipLine(in);
+        }else if (*in == 'm'){
+            while (*in != ';' && *in != EOF) ++in;
+            if (*in == ';') ++in;
+        }else{
+            readPbTerms(in, S, lits, coefs);
+            int rel = *in;
+            if (rel == ';') printf("PARSE ERROR! Missing relation\n"), exit(3);
+            ++in;
+            if (rel != '=' && !eagerMatch(in, "=")) printf("PARSE ERROR! Unexpected char: %c\n", *in), exit(3);
+            int64_t rhs = parseInt64(in);
+            skipWhitespace(in);
+            if (*in != ';') printf("PARSE ERROR! Unexpected char: %c\n", *in), exit(3);
+            ++in;
+            if (!S.pbFits(coefs, rhs)) printf("PARSE ERROR! Coefficients too large\n"), exit(3);
+
+            if (rel != '<')
+                S.addPb(lits, coefs, rhs);
+            if (rel != '>'){
+                for (int i = 0; i < coefs.size(); i++)
+                    coefs[i] = -coefs[i];
+                S.addPb(lits, coefs, -rhs); }
+        }
+    }
+}
+
+// Inserts problem into solver.
+//
+template<class Solver>
+static void parse_OPB(gzFile input_stream, Solver& S) {
+    StreamBuffer in(input_stream);
+    parse_OPB_main(in, S); }
+
+//=================================================================================================
+}
+
+#endif
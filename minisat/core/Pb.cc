@@ -0,0 +1,130 @@
+/*******************************************************************************************[Pb.cc]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#include "minisat/mtl/Sort.h"
+#include "minisat/core/Pb.h"
+#include "minisat/core/Solver.h"
+
+using namespace Minisat;
+
+namespace {
+struct Term { Lit lit; int64_t coef; };
+struct TermGt { bool operator()(const Term& a, const Term& b) const { return a.coef > b.coef; } };
+}
+
+
+PbPropagator::PbPropagator() : propagations(0), conflicts(0) {}
+
+
+void PbPropagator::addPb(Solver& S, const vec<Lit>& ls, const vec<int64_t>& cs, int64_t bound)
+{
+    assert(ls.size() == cs.size());
+    vec<Term> terms;
+    int64_t   sum = 0;
+    for (int i = 0; i < ls.size(); i++){
+        assert(S.value(ls[i]) == l_Undef);
+        assert(cs[i] > 0 && cs[i] <= bound && cs[i] <= INT64_MAX - sum);
+        Term t = { ls[i], cs[i] };
+        terms.push(t);
+        sum += cs[i]; }
+    sort(terms, TermGt());
+    assert(terms[0].coef <= sum - bound);
+
+    Pb c = { lits.size(), terms.size(), sum - bound, sum - bound };
+    for (int i = 0; i < terms.size(); i++){
+        Lit p = terms[i].lit;
+        Occ o = { pbs.size(), lits.size() };
+        lits .push(p);
+        coefs.push(terms[i].coef);
+        occs.growTo(2*(var(p)+1));
+        if (occs[toInt(~p)].size() == 0)
+            S.watchLit(~p, this);
+        occs[toInt(~p)].push(o);
+        stamp     .growTo(var(p)+1, 0);
+        reason_pb .growTo(var(p)+1, -1);
+        reason_pos.growTo(var(p)+1, 0);
+    }
+    pbs.push(c);
+}
+
+
+bool PbPropagator::propagate(Solver& S, Lit p, vec<Lit>& out_conflict)
+{
+    const vec<Occ>& os = occs[toInt(p)];
+    stamp[var(p)] = counted.size();
+    counted.push(p);
+
+    // Count 'p' everywhere first, so that backtracking can undo it the same way:
+    int confl = -1;
+    for (int i = 0; i < os.size(); i++)
+        if ((pbs[os[i].pb].slack -= coefs[os[i].idx]) < 0 && confl == -1)
+            confl = os[i].pb;
+    if (confl != -1){
+        conflicts++;
+        falseLits(S, pbs[confl], pbs[confl].total, counted.size(), out_conflict);
+        return false; }
+
+    for (int i = 0; i < os.size(); i++){
+        const Pb& c = pbs[os[i].pb];
+        for (int j = c.start; j < c.start + c.size && coefs[j] > c.slack; j++){
+            S.ticks++;
+            if (S.value(lits[j]) == l_Undef){
+                reason_pb [var(lits[j])] = os[i].pb;
+                reason_pos[var(lits[j])] = counted.size();
+                S.enqueueLazy(lits[j], this);
+                propagations++; }
+        }
+    }
+    return true;
+}
+
+
+// Add the largest false literals of 'c' counted before position 'limit' to 'out', until the sum of
+// their coefficients exceeds 'need':
+void PbPropagator::falseLits(Solver&, const Pb& c, int64_t need, int limit, vec<Lit>& out)
+{
+    int64_t sum = 0;
+    for (int j = c.start; j < c.start + c.size && sum <= need; j++)
+        if (isCounted(~lits[j]) && stamp[var(lits[j])] < limit){
+            out.push(lits[j]);
+            sum += coefs[j]; }
+    assert(sum > need);
+}
+
+
+void PbPropagator::explain(Solver& S, Lit p, vec<Lit>& out_reason)
+{
+    Var v = var(p);
+    assert(reason_pb[v] != -1);
+    const Pb& c = pbs[reason_pb[v]];
+    int64_t   w = 0;
+    for (int j = c.start; j < c.start + c.size; j++)
+        if (lits[j] == p){ w = coefs[j]; break; }
+    out_reason.push(p);
+    falseLits(S, c, c.total - w, reason_pos[v], out_reason);
+}
+
+
+void PbPropagator::backtrack(Solver& S, int)
+{
+    while (counted.size() > 0 && S.value(counted.last()) == l_Undef){
+        const vec<Occ>& os = occs[toInt(counted.last())];
+        for (int i = 0; i < os.size(); i++)
+            pbs[os[i].pb].slack += coefs[os[i].idx];
+        counted.pop();
+    }
+}
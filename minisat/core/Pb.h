@@ -0,0 +1,72 @@
+/********************************************************************************************[Pb.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Pb_h
+#define Minisat_Pb_h
+
+#include "minisat/mtl/Vec.h"
+#include "minisat/core/Propagator.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// PbPropagator -- linear pseudo-Boolean constraints 'sum coef_i * lit_i >= bound':
+//
+// Every constraint keeps its slack, the sum of the coefficients of its literals that are not false
+// minus the bound, and is notified when one of its literals becomes false. A negative slack is a
+// conflict; an unassigned literal with a coefficient above the slack is implied. Coefficients are
+// sorted in decreasing order, so only a prefix is scanned for implications. Reasons are built from
+// the largest false literals that were assigned before the implied one and suffice to justify it.
+
+class PbPropagator : public Propagator {
+public:
+    PbPropagator();
+
+    // Literals must be unassigned and distinct, coefficients positive and at most 'bound', their
+    // sum at most INT64_MAX, and no literal may be implied yet (no coefficient above the slack):
+    void     addPb    (Solver& S, const vec<Lit>& lits, const vec<int64_t>& coefs, int64_t bound);
+    int      nConstraints() const { return pbs.size(); }
+
+    bool     propagate(Solver& S, Lit p, vec<Lit>& out_conflict);
+    void     explain  (Solver& S, Lit p, vec<Lit>& out_reason);
+    void     backtrack(Solver& S, int level);
+
+    // Statistics:
+    //
+    uint64_t propagations, conflicts;
+
+protected:
+    struct Pb  { int start, size; int64_t total, slack; }; // 'total': the slack with no literal false.
+    struct Occ { int pb, idx; };
+
+    vec<Pb>         pbs;
+    vec<Lit>        lits;           // Literals of all constraints ('start' and 'size' index into this),
+    vec<int64_t>    coefs;          // and their coefficients.
+    vec<vec<Occ> >  occs;           // 'occs[toInt(p)]': the constraints in which 'p' makes a literal false.
+    vec<Lit>        counted;        // Literals counted against the slack, in trail order,
+    vec<int>        stamp;          // and the position of each variable in it.
+    vec<int>        reason_pb;      // Constraint that implied each variable (if it did),
+    vec<int>        reason_pos;     // and the size of 'counted' at that point.
+
+    bool     isCounted(Lit p) const { return stamp[var(p)] < counted.size() && counted[stamp[var(p)]] == p; }
+    void     falseLits(Solver& S, const Pb& c, int64_t need, int limit, vec<Lit>& out);
+};
+
+//=================================================================================================
+}
+
+#endif
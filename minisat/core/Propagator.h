@@ -0,0 +1,67 @@
+/************************************************************************************[Propagator.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Propagator_h
+#define Minisat_Propagator_h
+
+#include "minisat/mtl/Vec.h"
+#include "minisat/core/SolverTypes.h"
+
+namespace Minisat {
+
+class Solver;
+
+//=================================================================================================
+// Propagator -- a constraint propagated outside of the clause database:
+//
+// A propagator is registered with 'Solver::addPropagator()' and asks to be notified about literals
+// with 'Solver::watchLit()'. Once unit propagation over the clauses has reached a fixpoint, the
+// solver calls 'propagate()' for each newly assigned watched literal, and then 'fixpoint()' before
+// it makes a decision (or accepts a model). Implied literals are enqueued with
+// 'Solver::enqueueLazy()': no clause is built, 'explain()' is only called if conflict analysis
+// needs the reason. Variables used by a propagator must be frozen in a 'SimpSolver'.
+
+class Propagator {
+public:
+    virtual ~Propagator() {}
+
+    // Watched literal 'p' became true. Returns FALSE on conflict, leaving a clause of false
+    // literals in 'out_conflict'. If none is from the current decision level, 'Solver::propagate()'
+    // still returns at the current level; the conflict is analyzed after backtracking to the highest
+    // level among them (by 'search()', or by 'learn_clause' in the C interface):
+    virtual bool propagate(Solver& S, Lit p, vec<Lit>& out_conflict) = 0;
+
+    // All watched literals are propagated. May imply more literals; same result as 'propagate()':
+    virtual bool fixpoint (Solver& /*S*/, vec<Lit>& /*out_conflict*/) { return true; }
+
+    // Reason for a literal 'p' this propagator implied: 'p' followed by false literals that were
+    // all assigned before 'p'.
+    virtual void explain  (Solver& S, Lit p, vec<Lit>& out_reason) = 0;
+
+    // The solver backtracked to decision level 'level' (assignments above it are undone):
+    virtual void backtrack(Solver& /*S*/, int /*level*/) {}
+
+    // Whether conflicts and reasons are kept for good (apart from the problem and learnt clauses)
+    // instead of being freed again by backtracking. Reasons are then explained as soon as a literal
+    // is implied:
+    virtual bool permanent() const { return false; }
+};
+
+//=================================================================================================
+}
+
+#endif
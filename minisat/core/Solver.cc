@@ -19,12 +19,21 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 **************************************************************************************************/
 
 #include <math.h>
+#include <stdarg.h>
+#include <string.h>
 #include <vector>
 
 #include "minisat/mtl/Alg.h"
 #include "minisat/mtl/Sort.h"
 #include "minisat/utils/System.h"
 #include "minisat/core/Solver.h"
+#include "minisat/core/Card.h"
+#include "minisat/core/Amo.h"
+#include "minisat/core/Pb.h"
+#include "minisat/core/Canon.h"
+#include "minisat/core/Connect.h"
+#include "minisat/core/Acyclic.h"
+#include "minisat/core/External.h"
 
 using namespace Minisat;
 
@@ -46,6 +55,14 @@ static IntOption     opt_restart_first     (_cat, "rfirst",      "The base resta
 static DoubleOption  opt_restart_inc       (_cat, "rinc",        "Restart interval increase factor", 2, DoubleRange(1, false, HUGE_VAL, false));
 static DoubleOption  opt_garbage_frac      (_cat, "gc-frac",     "The fraction of wasted memory allowed before a garbage collection is triggered",  0.20, DoubleRange(0, false, HUGE_VAL, false));
 static IntOption     opt_min_learnts_lim   (_cat, "min-learnts", "Minimum learnt clause limit",  0, IntRange(0, INT32_MAX));
+static BoolOption    opt_ext_demote        (_cat, "ext-demote",  "Demote external clauses unused in conflict analysis since the last reduction to learnt ones", false);
+static IntOption     opt_stats_fd          (_cat, "stats-fd",    "Write periodic statistics as JSON lines to this file descriptor (-1 = off)", -1, IntRange(-1, INT32_MAX));
+static IntOption     opt_stats_confl       (_cat, "stats-confl", "Write statistics every this many conflicts (0 = never)", 0, IntRange(0, INT32_MAX));
+static DoubleOption  opt_stats_interval    (_cat, "stats-time",  "Write statistics every this many seconds of CPU time (0 = never)", 1, DoubleRange(0, true, HUGE_VAL, false));
+static BoolOption    opt_telemetry         (_cat, "telemetry",   "Collect histograms of learnt clause size, LBD, backjump distance and lifetime", false);
+static IntOption     opt_canon_cutoff      (_cat, "canon-cutoff","Search nodes per canonicity check of a partial graph (complete graphs are checked exactly)", 20000, IntRange(1, INT32_MAX));
+static IntOption     opt_canon_freq        (_cat, "canon-freq",  "Check the canonicity of partial graphs at every this many propagation fixpoints", 20, IntRange(1, INT32_MAX));
+static IntOption     opt_canon_cache       (_cat, "canon-cache", "Remember the canonicity checks of 2^this many partial graphs (0 = off)", 16, IntRange(0, 30));
 
 
 //=================================================================================================
@@ -68,6 +85,7 @@ Solver::Solver() :
   , rnd_init_act     (opt_rnd_init_act)
   , garbage_frac     (opt_garbage_frac)
   , min_learnts_lim  (opt_min_learnts_lim)
+  , ext_demote       (opt_ext_demote)
   , restart_first    (opt_restart_first)
   , restart_inc      (opt_restart_inc)
 
@@ -80,10 +98,27 @@ Solver::Solver() :
   , learntsize_adjust_start_confl (100)
   , learntsize_adjust_inc         (1.5)
 
+    // Statistics stream:
+    //
+  , stats_fd         (opt_stats_fd)
+  , stats_confl      (opt_stats_confl)
+  , stats_interval   (opt_stats_interval)
+  , telemetry        (opt_telemetry)
+
+  , inprocess_confl    (0)
+  , inprocess_effort   (0.1)
+
+  , time_check_interval(1000)
+
+  , canon_cutoff       (opt_canon_cutoff)
+  , canon_freq         (opt_canon_freq)
+  , canon_cache        (opt_canon_cache)
+
     // Statistics: (formerly in 'SolverStats')
     //
-  , solves(0), starts(0), decisions(0), rnd_decisions(0), propagations(0), conflicts(0)
+  , solves(0), starts(0), decisions(0), rnd_decisions(0), propagations(0), conflicts(0), inprocessings(0), ticks(0)
   , dec_vars(0), num_clauses(0), num_learnts(0), clauses_literals(0), learnts_literals(0), max_literals(0), tot_literals(0)
+  , num_externals(0), externals_literals(0), ext_demoted(0)
 
   , watches            (WatcherDeleted(ca))
   , order_heap         (VarOrderLt(activity))
@@ -97,16 +132,45 @@ Solver::Solver() :
   , remove_satisfied   (true)
   , next_var           (0)
 
+  , next_inprocess     (0)
+  , inprocess_ticks    (0)
+  , stats_next_confl   (0)
+  , stats_next_time    (0)
+  , stats_last_time    (0)
+  , stats_last_confl   (0)
+  , stats_last_dec     (0)
+  , stats_last_props   (0)
+  , lbd_counter        (0)
+
     // Resource constraints:
     //
   , conflict_budget    (-1)
   , propagation_budget (-1)
+  , tick_budget        (-1)
+  , time_budget        (-1)
+  , time_check_props   (0)
+  , time_out           (false)
   , asynch_interrupt   (false)
+  , prop_qhead         (0)
+  , cards              (NULL)
+  , amos               (NULL)
+  , pbs                (NULL)
+  , external           (NULL)
 {}
 
 
 Solver::~Solver()
 {
+    delete cards;
+    delete amos;
+    delete pbs;
+    delete external;
+    for (int i = 0; i < canons.size(); i++)
+        delete canons[i];
+    for (int i = 0; i < connects.size(); i++)
+        delete connects[i];
+    for (int i = 0; i < acyclics.size(); i++)
+        delete acyclics[i];
 }
 
 
@@ -132,6 +196,10 @@ Var Solver::newVar(lbool upol, bool dvar)
     vardata  .insert(v, mkVarData(CRef_Undef, 0));
     activity .insert(v, rnd_init_act ? drand(random_seed) * 0.00001 : 0);
     seen     .insert(v, 0);
+    prop_reason.insert(v, NULL);
+    prop_watches.growTo(2*(v+1));
+    prop_watches[toInt(mkLit(v, false))].clear();
+    prop_watches[toInt(mkLit(v, true ))].clear();
     polarity .insert(v, true);
     user_pol .insert(v, upol);
     decision .reserve(v);
@@ -146,7 +214,9 @@ Var Solver::newVar(lbool upol, bool dvar)
 void Solver::releaseVar(Lit l)
 {
     if (value(l) == l_Undef){
-        addClause(l);
+        add_tmp.clear();
+        add_tmp.push(l);
+        addClause_(add_tmp);
         released_vars.push(var(l));
     }
 }
@@ -182,12 +252,339 @@ bool Solver::addClause_(vec<Lit>& ps)
 }
 
 
+bool Solver::addAtMost(const vec<Lit>& ps, int k)
+{
+    assert(decisionLevel() == 0);
+    if (!ok) return false;
+
+    // Remove assigned and duplicate literals, and pairs of complementary literals (exactly one of
+    // which is true):
+    ps.copyTo(add_tmp);
+    sort(add_tmp);
+    int i, j;
+    for (i = j = 0; i < add_tmp.size(); i++)
+        if (value(add_tmp[i]) == l_True)
+            k--;
+        else if (value(add_tmp[i]) == l_False || (j > 0 && add_tmp[i] == add_tmp[j-1]))
+            continue;
+        else if (j > 0 && add_tmp[i] == ~add_tmp[j-1])
+            j--, k--;
+        else
+            add_tmp[j++] = add_tmp[i];
+    add_tmp.shrink(i - j);
+
+    if (k < 0)
+        return ok = false;
+    else if (k >= add_tmp.size())
+        return true;
+    else if (k == 0){
+        for (i = 0; i < add_tmp.size(); i++)
+            uncheckedEnqueue(~add_tmp[i]);
+        return ok = (propagate() == CRef_Undef);
+    }else if (k == 1 && add_tmp.size() == 2){
+        add_tmp[0] = ~add_tmp[0];
+        add_tmp[1] = ~add_tmp[1];
+        return addClause_(add_tmp);
+    }else if (k == 1){
+        if (amos == NULL){
+            amos = new AmoPropagator();
+            addPropagator(amos); }
+        amos->addAtMostOne(*this, add_tmp);
+        return true;
+    }
+
+    if (cards == NULL){
+        cards = new CardPropagator();
+        addPropagator(cards); }
+    cards->addAtMost(*this, add_tmp, k);
+    return true;
+}
+
+
+bool Solver::addAtLeast(const vec<Lit>& ps, int k)
+{
+    // At least 'k' true is at most 'n-k' false:
+    vec<Lit> neg;
+    ps.copyTo(neg);
+    sort(neg);
+    int i, j;
+    for (i = j = 0; i < neg.size(); i++)
+        if (j == 0 || neg[i] != neg[j-1])
+            neg[j++] = neg[i];
+    neg.shrink(i - j);
+    for (i = 0; i < neg.size(); i++)
+        neg[i] = ~neg[i];
+    return addAtMost(neg, neg.size() - k);
+}
+
+
+namespace {
+struct PbTerm   { Lit lit; int64_t coef; };
+struct PbTermLt { bool operator()(const PbTerm& a, const PbTerm& b) const { return a.lit < b.lit; } };
+}
+
+// With the absolute values summing up to at most INT64_MAX, no step of 'addPb()' can overflow:
+bool Solver::pbFits(const vec<int64_t>& cs, int64_t bound)
+{
+    if (bound == INT64_MIN) return false;
+    int64_t total = bound < 0 ? -bound : bound;
+    for (int i = 0; i < cs.size(); i++){
+        if (cs[i] == INT64_MIN) return false;
+        int64_t a = cs[i] < 0 ? -cs[i] : cs[i];
+        if (a > INT64_MAX - total) return false;
+        total += a; }
+    return true;
+}
+
+
+bool Solver::addPb(const vec<Lit>& ps, const vec<int64_t>& cs, int64_t bound)
+{
+    assert(decisionLevel() == 0);
+    assert(ps.size() == cs.size());
+    if (!ok || !pbFits(cs, bound)) return false;
+
+    // Make the coefficients positive and remove assigned literals:
+    vec<PbTerm> ts;
+    for (int i = 0; i < ps.size(); i++){
+        PbTerm t = { ps[i], cs[i] };
+        if (t.coef < 0)
+            t.lit = ~t.lit, t.coef = -t.coef, bound += t.coef;
+        if (t.coef == 0 || value(t.lit) == l_False)
+            continue;
+        else if (value(t.lit) == l_True)
+            bound -= t.coef;
+        else
+            ts.push(t);
+    }
+
+    // Merge duplicate literals; of a complementary pair 'c*x + d*~x' (c >= d), 'd' is always
+    // satisfied and '(c-d)*x' remains:
+    sort(ts, PbTermLt());
+    int i, j;
+    for (i = j = 0; i < ts.size(); i++)
+        if (j > 0 && ts[i].lit == ts[j-1].lit)
+            ts[j-1].coef += ts[i].coef;
+        else if (j > 0 && ts[i].lit == ~ts[j-1].lit){
+            int64_t d = ts[i].coef < ts[j-1].coef ? ts[i].coef : ts[j-1].coef;
+            bound -= d;
+            if (ts[i].coef > ts[j-1].coef)
+                ts[j-1].lit = ts[i].lit;
+            if ((ts[j-1].coef = ts[i].coef + ts[j-1].coef - 2*d) == 0)
+                j--;
+        }else
+            ts[j++] = ts[i];
+    ts.shrink(i - j);
+
+    if (bound <= 0)
+        return true;
+
+    // Saturate, and enqueue the literals the constraint implies already:
+    int64_t sum    = 0;
+    bool    all_eq = true;
+    for (i = 0; i < ts.size(); i++){
+        if (ts[i].coef > bound) ts[i].coef = bound;
+        sum       += ts[i].coef;
+        all_eq     = all_eq && ts[i].coef == ts[0].coef; }
+    if (sum < bound)
+        return ok = false;
+
+    vec<Lit>     lits;
+    vec<int64_t> coefs;
+    bool         units = false;
+    for (i = 0; i < ts.size(); i++){
+        if (ts[i].coef > sum - bound)
+            uncheckedEnqueue(ts[i].lit), units = true;
+        lits .push(ts[i].lit);
+        coefs.push(ts[i].coef); }
+    if (units)
+        return (ok = propagate() == CRef_Undef) && addPb(lits, coefs, bound);
+
+    // Equal coefficients make a clause or a cardinality constraint:
+    if (all_eq){
+        int k = (int)((bound + ts[0].coef - 1) / ts[0].coef);
+        return k == 1 ? addClause_(lits) : addAtLeast(lits, k); }
+
+    if (pbs == NULL){
+        pbs = new PbPropagator();
+        addPropagator(pbs); }
+    pbs->addPb(*this, lits, coefs, bound);
+    return true;
+}
+
+
+bool Solver::addCanonicity(int n, const vec<Lit>& edges)
+{
+    assert(decisionLevel() == 0);
+    if (!ok) return false;
+
+    CanonPropagator* cp = new CanonPropagator(n, edges, canon_cutoff, canon_freq, canon_cache);
+    canons.push(cp);
+    cp->attach(*this);
+    return true;
+}
+
+
+bool Solver::addConnectivity(int n, const vec<Lit>& edges)
+{
+    assert(decisionLevel() == 0);
+    if (!ok) return false;
+
+    ConnectPropagator* cp = new ConnectPropagator(n, edges);
+    connects.push(cp);
+    cp->attach(*this);
+    return ok = propagate() == CRef_Undef;
+}
+
+
+bool Solver::addAcyclicity(int n, const vec<Lit>& arcs)
+{
+    assert(decisionLevel() == 0);
+    if (!ok) return false;
+
+    // Loops are false; the arcs true so far must be propagated before attaching:
+    for (int i = 0; i < n; i++)
+        if (arcs[i*n + i] != lit_Undef && value(arcs[i*n + i]) != l_False){
+            if (value(arcs[i*n + i]) == l_True)
+                return ok = false;
+            uncheckedEnqueue(~arcs[i*n + i]); }
+    if (!(ok = propagate() == CRef_Undef)) return false;
+
+    vec<Lit> as;
+    arcs.copyTo(as);
+    for (int i = 0; i < n; i++)
+        as[i*n + i] = lit_Undef;
+    AcyclicPropagator* ap = new AcyclicPropagator(n, as);
+    acyclics.push(ap);
+    ap->attach(*this);
+    return ok = propagate() == CRef_Undef;
+}
+
+
+// Learnt clauses derived from a removable clause contain its activation literal, so releasing the
+// variable (making the literal true) removes them together with the clause at the next 'simplify()'.
+int Solver::addRemovableClause(const vec<Lit>& ps)
+{
+    assert(decisionLevel() == 0);
+    Var      a = newVar(l_Undef, false);
+    vec<Lit> c;
+    ps.copyTo(c);
+    c.push(mkLit(a));
+    addScoped(c);
+
+    int h;
+    if (free_handles.size() > 0){
+        h = free_handles.last();
+        free_handles.pop();
+        removable_act[h] = a;
+    }else{
+        h = removable_act.size();
+        removable_act.push(a); }
+    return h;
+}
+
+
+void Solver::dropClause(int h)
+{
+    assert(decisionLevel() == 0);
+    assert(removable_act[h] != var_Undef);
+    releaseVar(mkLit(removable_act[h]));
+    removable_act[h] = var_Undef;
+    free_handles.push(h);
+}
+
+
+void Solver::push()
+{
+    assert(decisionLevel() == 0);
+    scope_act.push(newVar(l_Undef, false));
+}
+
+
+void Solver::pop()
+{
+    assert(decisionLevel() == 0);
+    assert(scope_act.size() > 0);
+    releaseVar(mkLit(scope_act.last()));
+    scope_act.pop();
+
+    // Remove the satisfied clauses now rather than at the next scheduled 'simplify()':
+    simpDB_props = 0;
+    simplify();
+}
+
+
+// Order of preference for the watched literals of a clause added during search: unassigned, true
+// from the lowest level, false from the highest level.
+static bool watchBefore(const Solver& S, Lit p, Lit q)
+{
+    lbool vp = S.value(p), vq = S.value(q);
+    if (vp != vq)      return vp == l_Undef || (vp == l_True && vq == l_False);
+    if (vp == l_Undef) return false;
+    return vp == l_True ? S.level(var(p)) < S.level(var(q)) : S.level(var(p)) > S.level(var(q));
+}
+
+CRef Solver::addExternalClause(const vec<Lit>& ps)
+{
+    if (!ok) return CRef_Undef;
+
+    // Remove duplicate literals, skip tautologies (assigned literals are kept, they may be unassigned
+    // by backtracking):
+    vec<Lit> c;
+    ps.copyTo(c);
+    sort(c);
+    Lit p; int i, j;
+    for (i = j = 0, p = lit_Undef; i < c.size(); i++)
+        if (c[i] == ~p)
+            return CRef_Undef;
+        else if (c[i] != p)
+            c[j++] = p = c[i];
+    c.shrink(i - j);
+
+    if (c.size() <= 1){
+        cancelUntil(0);
+        if (c.size() == 0 || value(c[0]) == l_False)
+            ok = false;
+        else if (value(c[0]) == l_Undef)
+            uncheckedEnqueue(c[0]);
+        return CRef_Undef;
+    }
+
+    for (int k = 0; k < 2; k++){
+        int best = k;
+        for (i = k+1; i < c.size(); i++)
+            if (watchBefore(*this, c[i], c[best]))
+                best = i;
+        Lit tmp = c[k]; c[k] = c[best]; c[best] = tmp; }
+
+    CRef cr = ca.alloc(c, true);
+    ca[cr].external(true);
+    externals.push(cr);
+
+    if (value(c[1]) == l_False && (value(c[0]) == l_Undef || level(var(c[0])) > level(var(c[1])))){
+        // Unit: implies the first literal at the level of the second (also if the first is false
+        // at a higher level):
+        cancelUntil(level(var(c[1])));
+        attachClause(cr);
+        uncheckedEnqueue(c[0], cr);
+    }else if (value(c[0]) == l_False){
+        // False, with two literals at the highest level: conflicting there.
+        cancelUntil(level(var(c[0])));
+        attachClause(cr);
+        if (decisionLevel() == 0) ok = false;
+        return cr;
+    }else
+        attachClause(cr);
+    return CRef_Undef;
+}
+
+
 void Solver::attachClause(CRef cr){
     const Clause& c = ca[cr];
     assert(c.size() > 1);
     watches[~c[0]].push(Watcher(cr, c[1]));
     watches[~c[1]].push(Watcher(cr, c[0]));
-    if (c.learnt()) num_learnts++, learnts_literals += c.size();
+    if      (c.external()) num_externals++, externals_literals += c.size();
+    else if (c.learnt()) num_learnts++, learnts_literals += c.size();
     else            num_clauses++, clauses_literals += c.size();
 }
 
@@ -205,13 +602,16 @@ void Solver::detachClause(CRef cr, bool strict){
         watches.smudge(~c[1]);
     }
 
-    if (c.learnt()) num_learnts--, learnts_literals -= c.size();
+    if      (c.external()) num_externals--, externals_literals -= c.size();
+    else if (c.learnt()) num_learnts--, learnts_literals -= c.size();
     else            num_clauses--, clauses_literals -= c.size();
 }
 
 
 void Solver::removeClause(CRef cr) {
     Clause& c = ca[cr];
+    uint64_t birth;
+    if (telemetry && c.learnt() && learnt_birth.has(cr, birth)) learnt_birth.remove(cr);
     detachClause(cr);
     // Don't leave pointers to free'd memory!
     if (locked(c)) vardata[var(c[0])].reason = CRef_Undef;
@@ -238,8 +638,24 @@ void Solver::cancelUntil(int level) {
                 polarity[x] = sign(trail[c]);
             insertVarOrder(x); }
         qhead = trail_lim[level];
+        if (prop_qhead > qhead) prop_qhead = qhead;
         trail.shrink(trail.size() - trail_lim[level]);
         trail_lim.shrink(trail_lim.size() - level);
+
+        // Free the explained reasons and conflicts of propagators above 'level':
+        int i, j;
+        for (i = j = 0; i < prop_clauses.size(); i++)
+            if (prop_levels[i] > level)
+                ca.free(prop_clauses[i]);
+            else{
+                prop_clauses[j] = prop_clauses[i];
+                prop_levels [j] = prop_levels [i];
+                j++; }
+        prop_clauses.shrink(i - j);
+        prop_levels .shrink(i - j);
+
+        for (int k = 0; k < propagators.size(); k++)
+            propagators[k]->backtrack(*this, level);
     } }
 
 
@@ -306,7 +722,9 @@ void Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
 
     do{
         assert(confl != CRef_Undef); // (otherwise should be UIP)
+        if (confl == CRef_Lazy) confl = lazyReason(var(p));
         Clause& c = ca[confl];
+        ticks++;
 
         if (c.learnt())
             claBumpActivity(c);
@@ -350,7 +768,8 @@ void Solver::analyze(CRef confl, vec<Lit>& out_learnt, int& out_btlevel)
             if (reason(x) == CRef_Undef)
                 out_learnt[j++] = out_learnt[i];
             else{
-                Clause& c = ca[reason(var(out_learnt[i]))];
+                Clause& c = ca[reasonClause(x)];
+                ticks++;
                 for (int k = 1; k < c.size(); k++)
                     if (!seen[var(c[k])] && level(var(c[k])) > 0){
                         out_learnt[j++] = out_learnt[i];
@@ -392,9 +811,10 @@ bool Solver::litRedundant(Lit p)
     assert(seen[var(p)] == seen_undef || seen[var(p)] == seen_source);
     assert(reason(var(p)) != CRef_Undef);
 
-    Clause*               c     = &ca[reason(var(p))];
+    Clause*               c     = &ca[reasonClause(var(p))];
     vec<ShrinkStackElem>& stack = analyze_stack;
     stack.clear();
+    ticks++;
 
     for (uint32_t i = 1; ; i++){
         if (i < (uint32_t)c->size()){
@@ -421,7 +841,8 @@ bool Solver::litRedundant(Lit p)
             stack.push(ShrinkStackElem(i, p));
             i  = 0;
             p  = l;
-            c  = &ca[reason(var(p))];
+            c  = &ca[reasonClause(var(p))];
+            ticks++;
         }else{
             // Finished with current element 'p' and reason 'c':
             if (seen[var(p)] == seen_undef){
@@ -435,7 +856,7 @@ bool Solver::litRedundant(Lit p)
             // Continue with top element on stack:
             i  = stack.last().i;
             p  = stack.last().l;
-            c  = &ca[reason(var(p))];
+            c  = &ca[reasonClause(var(p))];
 
             stack.pop();
         }
@@ -471,7 +892,7 @@ void Solver::analyzeFinal(Lit p, LSet& out_conflict)
                 assert(level(x) > 0);
                 out_conflict.insert(~trail[i]);
             }else{
-                Clause& c = ca[reason(x)];
+                Clause& c = ca[reasonClause(x)];
                 for (int j = 1; j < c.size(); j++)
                     if (level(var(c[j])) > 0)
                         seen[var(c[j])] = 1;
@@ -499,21 +920,125 @@ void Solver::uncheckedEnqueue(Lit p, CRef from)
 |  
 |  Description:
 |    Propagates all enqueued facts. If a conflict arises, the conflicting clause is returned,
-|    otherwise CRef_Undef.
+|    otherwise CRef_Undef. Propagators run whenever the clauses have reached a fixpoint; their
+|    conflicts are returned as temporary clauses that are freed again by backtracking.
 |  
 |    Post-conditions:
 |      * the propagation queue is empty, even if there was a conflict.
 |________________________________________________________________________________________________@*/
 CRef Solver::propagate()
+{
+    CRef confl = propagateClauses();
+    if (propagators.size() == 0)
+        return confl;
+
+    while (confl == CRef_Undef){
+        // Notify the propagators about new literals, but return to the (cheaper) clauses as soon
+        // as anything was implied:
+        int         assigned = trail.size();
+        bool        no_confl = true;
+        Propagator* from     = NULL;
+        while (no_confl && prop_qhead < assigned && trail.size() == assigned){
+            Lit                     p  = trail[prop_qhead++];
+            const vec<Propagator*>& ps = prop_watches[toInt(p)];
+            for (int i = 0; no_confl && i < ps.size(); i++){
+                prop_tmp.clear();
+                no_confl = (from = ps[i])->propagate(*this, p, prop_tmp); }
+        }
+        for (int i = 0; no_confl && trail.size() == assigned && i < propagators.size(); i++){
+            prop_tmp.clear();
+            no_confl = (from = propagators[i])->fixpoint(*this, prop_tmp); }
+
+        if (!no_confl)
+            confl = propagatorConflict(prop_tmp, from);
+        else if (trail.size() == assigned)
+            break;
+        else
+            confl = propagateClauses();
+    }
+
+    return confl;
+}
+
+
+CRef Solver::propagatorConflict(vec<Lit>& c, Propagator* from)
+{
+    assert(decisionLevel() == 0 || c.size() > 0);
+
+    // A conflict may be found late (without literals from the current level). The solver does not
+    // backtrack here; the clause lives at the highest level of its literals, where the caller of
+    // 'propagate()' analyzes it (see 'conflictLevel()'):
+    for (int i = 1; i < c.size(); i++)
+        if (level(var(c[i])) > level(var(c[0]))){
+            Lit tmp = c[0]; c[0] = c[i]; c[i] = tmp; }
+
+    qhead = prop_qhead = trail.size();
+    return propagatorClause(c, from, c.size() > 0 ? level(var(c[0])) : 0);
+}
+
+
+int Solver::conflictLevel(CRef confl) const
+{
+    const Clause& c   = ca[confl];
+    int           max = 0;
+    for (int i = 0; i < c.size(); i++)
+        if (level(var(c[i])) > max)
+            max = level(var(c[i]));
+    return max;
+}
+
+
+// Materialize the reason of a literal implied by a propagator. The clause lives until the
+// literal is unassigned (or for good, see 'Propagator::permanent()').
+CRef Solver::lazyReason(Var x)
+{
+    assert(reason(x) == CRef_Lazy);
+    Lit p = mkLit(x, value(x) == l_False);
+    prop_tmp.clear();
+    prop_reason[x]->explain(*this, p, prop_tmp);
+    assert(prop_tmp.size() > 0 && prop_tmp[0] == p);
+
+    CRef cr = propagatorClause(prop_tmp, prop_reason[x], level(x));
+    vardata[x].reason = cr;
+    return cr;
+}
+
+
+// Clauses of permanent propagators are kept in 'prop_permanent', watched by their first literal and
+// the one of the others assigned last. The rest is freed when backtracking below 'lev'.
+CRef Solver::propagatorClause(const vec<Lit>& c, Propagator* from, int lev)
+{
+    bool keep = from->permanent() && c.size() > 1;
+    CRef cr   = ca.alloc(c, keep);
+    if (keep){
+        Clause& cl    = ca[cr];
+        int     max_i = 1;
+        for (int i = 2; i < cl.size(); i++)
+            if (level(var(cl[i])) > level(var(cl[max_i])))
+                max_i = i;
+        Lit tmp = cl[1]; cl[1] = cl[max_i]; cl[max_i] = tmp;
+        prop_permanent.push(cr);
+        attachClause(cr);
+    }else{
+        prop_clauses.push(cr);
+        prop_levels .push(lev);
+    }
+    return cr;
+}
+
+
+CRef Solver::propagateClauses()
 {
     CRef    confl     = CRef_Undef;
     int     num_props = 0;
+    int64_t num_ticks = 0;
 
     while (qhead < trail.size()){
         Lit            p   = trail[qhead++];     // 'p' is enqueued fact to propagate.
         vec<Watcher>&  ws  = watches.lookup(p);
         Watcher        *i, *j, *end;
         num_props++;
+        num_ticks += 1 + ws.size();
 
         for (i = j = (Watcher*)ws, end = i + ws.size();  i != end;){
             // Try to avoid inspecting the clause:
@@ -525,6 +1050,7 @@ CRef Solver::propagate()
             CRef     cr        = i->cref;
             Clause&  c         = ca[cr];
             Lit      false_lit = ~p;
+            num_ticks++;
             if (c[0] == false_lit)
                 c[0] = c[1], c[1] = false_lit;
             assert(c[1] == false_lit);
@@ -560,6 +1086,15 @@ CRef Solver::propagate()
     }
     propagations += num_props;
     simpDB_props -= num_props;
+    ticks        += num_ticks;
+
+    // Reading the clock is comparatively expensive, so the deadline is only checked every so many
+    // propagations. Propagation itself is never cut short; 'withinBudget()' picks up the flag:
+    if (time_budget >= 0 && (time_check_props -= num_props) <= 0){
+        time_check_props = time_check_interval;
+        if (realTime() >= time_budget)
+            time_out = true;
+    }
 
     return confl;
 }
@@ -589,12 +1124,33 @@ void Solver::reduceDB()
     // and clauses with activity smaller than 'extra_lim':
     for (i = j = 0; i < learnts.size(); i++){
         Clause& c = ca[learnts[i]];
-        if (c.size() > 2 && !locked(c) && (i < learnts.size() / 2 || c.activity() < extra_lim))
+        if (c.size() > 2 && !locked(c) && (i < learnts.size() / 2 || c.activity() < extra_lim)){
+            uint64_t birth;
+            if (telemetry && learnt_birth.has(learnts[i], birth))
+                hist_lifetime.add(conflicts - birth);
             removeClause(learnts[i]);
-        else
+        }else
             learnts[j++] = learnts[i];
     }
     learnts.shrink(i - j);
+
+    // Demote the external clauses whose activity was not bumped since the previous reduction. They
+    // are deleted like other learnt clauses from the next one on:
+    if (ext_demote){
+        for (i = j = 0; i < externals.size(); i++){
+            Clause& c = ca[externals[i]];
+            if (c.activity() == 0){
+                num_externals--, externals_literals -= c.size();
+                num_learnts++,   learnts_literals   += c.size();
+                c.external(false);
+                learnts.push(externals[i]);
+                ext_demoted++;
+            }else{
+                c.activity() = 0;
+                externals[j++] = externals[i]; }
+        }
+        externals.shrink(i - j);
+    }
     checkGarbage();
 }
 
@@ -651,6 +1207,8 @@ bool Solver::simplify()
 
     // Remove satisfied clauses:
     removeSatisfied(learnts);
+    removeSatisfied(externals);
+    removeSatisfied(prop_permanent);
     if (remove_satisfied){       // Can be turned off.
         removeSatisfied(clauses);
 
@@ -668,7 +1226,7 @@ bool Solver::simplify()
                 trail[j++] = trail[i];
         trail.shrink(i - j);
         //printf("trail.size()= %d, qhead = %d\n", trail.size(), qhead);
-        qhead = trail.size();
+        qhead = prop_qhead = trail.size();
 
         for (int i = 0; i < released_vars.size(); i++)
             seen[released_vars[i]] = 0;
@@ -713,10 +1271,13 @@ lbool Solver::search(int nof_conflicts)
         if (confl != CRef_Undef){
             // CONFLICT
             conflicts++; conflictC++;
+            if (conflictLevel(confl) < decisionLevel())
+                cancelUntil(conflictLevel(confl));
             if (decisionLevel() == 0) return l_False;
 
             learnt_clause.clear();
             analyze(confl, learnt_clause, backtrack_level);
+            if (telemetry) recordLearnt(learnt_clause, backtrack_level);
             cancelUntil(backtrack_level);
 
             if (learnt_clause.size() == 1){
@@ -726,6 +1287,7 @@ lbool Solver::search(int nof_conflicts)
                 learnts.push(cr);
                 attachClause(cr);
                 claBumpActivity(ca[cr]);
+                if (telemetry) learnt_birth.insert(cr, conflicts);
                 uncheckedEnqueue(learnt_clause[0], cr);
             }
 
@@ -744,6 +1306,11 @@ lbool Solver::search(int nof_conflicts)
                            (int)max_learnts, nLearnts(), (double)learnts_literals/nLearnts(), progressEstimate()*100);
             }
 
+            // Checking the clock is not free, so time-based statistics are only considered every 256 conflicts:
+            if (stats_fd >= 0 && ((stats_confl > 0 && conflicts >= stats_next_confl) ||
+                                  (stats_interval > 0 && (conflicts & 255) == 0 && cpuTime() >= stats_next_time)))
+                writeStats("progress");
+
         }else{
             // NO CONFLICT
             if ((nof_conflicts >= 0 && conflictC >= nof_conflicts) || !withinBudget()){
@@ -845,6 +1412,14 @@ lbool Solver::solve_()
 
     solves++;
 
+    // The removable clauses that were not dropped and the open scopes are active:
+    int user_assumps = assumptions.size();
+    for (int i = 0; i < removable_act.size(); i++)
+        if (removable_act[i] != var_Undef)
+            assumptions.push(~mkLit(removable_act[i]));
+    for (int i = 0; i < scope_act.size(); i++)
+        assumptions.push(~mkLit(scope_act[i]));
+
     max_learnts = nClauses() * learntsize_factor;
     if (max_learnts < min_learnts_lim)
         max_learnts = min_learnts_lim;
@@ -859,6 +1434,11 @@ lbool Solver::solve_()
         printf("|           |    Vars  Clauses Literals |    Limit  Clauses Lit/Cl |          |\n");
         printf("===============================================================================\n");
     }
+    resetStatsStream();
+
+    if (inprocess_confl > 0 && next_inprocess == 0){
+        next_inprocess  = conflicts + inprocess_confl;
+        inprocess_ticks = ticks; }
 
     // Search:
     int curr_restarts = 0;
@@ -867,6 +1447,16 @@ lbool Solver::solve_()
         status = search(rest_base * restart_first);
         if (!withinBudget()) break;
         curr_restarts++;
+
+        // Inprocessing between restarts, with growing intervals:
+        if (status == l_Undef && inprocess_confl > 0 && conflicts >= next_inprocess){
+            assert(decisionLevel() == 0);
+            inprocessings++;
+            if (!inprocess())
+                status = l_False;
+            next_inprocess  = conflicts + (inprocessings + 1) * inprocess_confl;
+            inprocess_ticks = ticks;
+        }
     }
 
     if (verbosity >= 1)
@@ -880,6 +1470,23 @@ lbool Solver::solve_()
     }else if (status == l_False && conflict.size() == 0)
         ok = false;
 
+    // Leave the activation literals out of the final conflict:
+    if (assumptions.size() > user_assumps){
+        for (int i = user_assumps; i < assumptions.size(); i++)
+            seen[var(assumptions[i])] = 1;
+        vec<Lit> keep;
+        for (int i = 0; i < conflict.size(); i++)
+            if (!seen[var(conflict[i])])
+                keep.push(conflict[i]);
+        conflict.clear();
+        for (int i = 0; i < keep.size(); i++)
+            conflict.insert(keep[i]);
+        for (int i = user_assumps; i < assumptions.size(); i++)
+            seen[var(assumptions[i])] = 0;
+        assumptions.shrink(assumptions.size() - user_assumps);
+    }
+
+    writeStats("solve", status);
     cancelUntil(0);
     return status;
 }
@@ -989,6 +1596,16 @@ void Solver::toDimacs(FILE* f, const vec<Lit>& assumps)
 }
 
 
+static void printHistogram(const char* name, const Histogram& h)
+{
+    printf("%-22s: mean %-8.2f max %-8" PRIu64" |", name, h.mean(), h.max());
+    for (int b = 0; b < h.buckets(); b++)
+        if (h.count(b) > 0)
+            printf(" %" PRIu64":%" PRIu64, Histogram::lower(b), h.count(b));
+    printf("\n");
+}
+
+
 void Solver::printStats() const
 {
     double cpu_time = cpuTime();
@@ -997,9 +1614,188 @@ void Solver::printStats() const
     printf("conflicts             : %-12" PRIu64"   (%.0f /sec)\n", conflicts   , conflicts   /cpu_time);
     printf("decisions             : %-12" PRIu64"   (%4.2f %% random) (%.0f /sec)\n", decisions, (float)rnd_decisions*100 / (float)decisions, decisions   /cpu_time);
     printf("propagations          : %-12" PRIu64"   (%.0f /sec)\n", propagations, propagations/cpu_time);
+    printf("ticks                 : %-12" PRIu64"   (%.0f /sec)\n", ticks, ticks/cpu_time);
+    if (inprocessings > 0)
+        printf("inprocessing rounds   : %" PRIu64"\n", inprocessings);
+    if (amos != NULL)
+        printf("at-most-one constrs   : %-12d   (%" PRIu64" conflicts, %" PRIu64" propagations)\n", amos->nConstraints(), amos->conflicts, amos->propagations);
+    if (canons.size() > 0){
+        uint64_t checks = 0, clauses = 0, aborted = 0, cached = 0;
+        for (int i = 0; i < canons.size(); i++){
+            checks  += canons[i]->checks;
+            clauses += canons[i]->conflicts + canons[i]->propagations;
+            aborted += canons[i]->aborted;
+            cached  += canons[i]->cache_hits; }
+        printf("canonicity checks     : %-12" PRIu64"   (%" PRIu64" clauses, %" PRIu64" aborted, %" PRIu64" cached)\n", checks, clauses, aborted, cached);
+    }
+    if (connects.size() > 0){
+        uint64_t checks = 0, propagations = 0, conflicts = 0;
+        for (int i = 0; i < connects.size(); i++){
+            checks       += connects[i]->checks;
+            propagations += connects[i]->propagations;
+            conflicts    += connects[i]->conflicts; }
+        printf("connectivity checks   : %-12" PRIu64"   (%" PRIu64" conflicts, %" PRIu64" propagations)\n", checks, conflicts, propagations);
+    }
+    if (num_externals + ext_demoted > 0)
+        printf("external clauses      : %-12" PRIu64"   (%" PRIu64" literals, %" PRIu64" demoted)\n", num_externals, externals_literals, ext_demoted);
+    if (external != NULL)
+        printf("lazy implications     : %-12" PRIu64"   (%" PRIu64" explained)\n", external->implied, external->explained);
+    if (acyclics.size() > 0){
+        uint64_t insertions = 0, propagations = 0, conflicts = 0;
+        for (int i = 0; i < acyclics.size(); i++){
+            insertions   += acyclics[i]->insertions;
+            propagations += acyclics[i]->propagations;
+            conflicts    += acyclics[i]->conflicts; }
+        printf("acyclicity insertions : %-12" PRIu64"   (%" PRIu64" conflicts, %" PRIu64" propagations)\n", insertions, conflicts, propagations);
+    }
     printf("conflict literals     : %-12" PRIu64"   (%4.2f %% deleted)\n", tot_literals, (max_literals - tot_literals)*100 / (double)max_literals);
     if (mem_used != 0) printf("Memory used           : %.2f MB\n", mem_used);
     printf("CPU time              : %g s\n", cpu_time);
+    if (telemetry){
+        printHistogram("learnt size",       hist_size);
+        printHistogram("learnt LBD",        hist_lbd);
+        printHistogram("backjump distance", hist_backjump);
+        printHistogram("learnt lifetime",   hist_lifetime);
+    }
+}
+
+
+//=================================================================================================
+// Learnt clause telemetry:
+
+
+int Solver::computeLBD(const vec<Lit>& c)
+{
+    lbd_counter++;
+    lbd_stamp.growTo(decisionLevel()+1, 0);
+    int lbd = 0;
+    for (int i = 0; i < c.size(); i++){
+        int l = level(var(c[i]));
+        if (lbd_stamp[l] != lbd_counter){
+            lbd_stamp[l] = lbd_counter;
+            lbd++; }
+    }
+    return lbd;
+}
+
+
+// NOTE: must be called before backtracking, while all literals of 'c' still have their levels.
+void Solver::recordLearnt(const vec<Lit>& c, int btlevel)
+{
+    hist_size    .add(c.size());
+    hist_lbd     .add(computeLBD(c));
+    hist_backjump.add(decisionLevel() - btlevel);
+}
+
+
+//=================================================================================================
+// Statistics stream:
+
+
+static void appendf(vec<char>& out, const char* fmt, ...)
+{
+    char    buf[256];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    for (int i = 0; i < n && i < (int)sizeof(buf)-1; i++)
+        out.push(buf[i]);
+}
+
+
+static inline double rate(uint64_t delta, double secs){ return secs > 0 ? delta / secs : 0; }
+
+
+// Non-empty buckets are written as [lower bound, count] pairs:
+static void appendHistogram(vec<char>& out, const char* name, const Histogram& h)
+{
+    appendf(out, "\"%s\":{\"samples\":%" PRIu64",\"mean\":%.3f,\"max\":%" PRIu64",\"buckets\":[", name, h.samples(), h.mean(), h.max());
+    bool first = true;
+    for (int b = 0; b < h.buckets(); b++)
+        if (h.count(b) > 0){
+            appendf(out, "%s[%" PRIu64",%" PRIu64"]", first ? "" : ",", Histogram::lower(b), h.count(b));
+            first = false; }
+    appendf(out, "]}");
+}
+
+
+void Solver::resetStatsStream()
+{
+    if (stats_fd < 0) return;
+    stats_last_time  = cpuTime();
+    stats_last_confl = conflicts;
+    stats_last_dec   = decisions;
+    stats_last_props = propagations;
+    stats_next_confl = conflicts + stats_confl;
+    stats_next_time  = stats_last_time + stats_interval;
+}
+
+
+// Writes one line of JSON (no embedded newlines) so that a monitoring process can follow the file
+// descriptor line by line. Counters are cumulative over the lifetime of the solver, rates are given
+// both over the total CPU time and over the interval since the previous line.
+void Solver::writeStats(const char* event, lbool status)
+{
+    if (stats_fd < 0) return;
+
+    double cpu_time = cpuTime();
+    double interval = cpu_time - stats_last_time;
+
+    uint64_t watch_bytes = 0;
+    for (int v = 0; v < nVars(); v++)
+        for (int s = 0; s < 2; s++)
+            watch_bytes += watches[mkLit(v, s)].capacity() * sizeof(Watcher);
+    uint64_t arena_bytes  = (uint64_t)ca.size()   * ClauseAllocator::Unit_Size;
+    uint64_t wasted_bytes = (uint64_t)ca.wasted() * ClauseAllocator::Unit_Size;
+    uint64_t trail_bytes  = (uint64_t)trail.capacity() * sizeof(Lit) + (uint64_t)trail_lim.capacity() * sizeof(int);
+    uint64_t var_bytes    = (uint64_t)nVars() * (sizeof(double) + 2*sizeof(lbool) + 3*sizeof(char) + sizeof(VarData));
+
+    vec<char> out;
+    appendf(out, "{\"event\":\"%s\",\"cpu_time\":%.3f", event, cpu_time);
+    if (status != l_Undef)
+        appendf(out, ",\"status\":\"%s\"", status == l_True ? "SAT" : "UNSAT");
+    else if (strcmp(event, "solve") == 0)
+        appendf(out, ",\"status\":\"UNKNOWN\"");
+
+    appendf(out, ",\"solves\":%" PRIu64",\"restarts\":%" PRIu64",\"inprocessings\":%" PRIu64",\"conflicts\":%" PRIu64,
+            solves, starts, inprocessings, conflicts);
+    appendf(out, ",\"decisions\":%" PRIu64",\"rnd_decisions\":%" PRIu64",\"propagations\":%" PRIu64",\"ticks\":%" PRIu64,
+            decisions, rnd_decisions, propagations, ticks);
+    appendf(out, ",\"conflict_literals\":%" PRIu64",\"deleted_literals\":%" PRIu64, tot_literals, max_literals - tot_literals);
+    appendf(out, ",\"vars\":%d,\"free_vars\":%d,\"root_assigns\":%d", nVars(), nFreeVars(),
+            trail_lim.size() == 0 ? trail.size() : trail_lim[0]);
+    appendf(out, ",\"clauses\":%" PRIu64",\"clause_literals\":%" PRIu64, num_clauses, clauses_literals);
+    appendf(out, ",\"learnts\":%" PRIu64",\"learnt_literals\":%" PRIu64",\"max_learnts\":%.0f", num_learnts, learnts_literals, max_learnts);
+    appendf(out, ",\"externals\":%" PRIu64",\"external_literals\":%" PRIu64",\"ext_demoted\":%" PRIu64, num_externals, externals_literals, ext_demoted);
+
+    appendf(out, ",\"memory\":{\"clause_arena\":%" PRIu64",\"clause_wasted\":%" PRIu64, arena_bytes, wasted_bytes);
+    appendf(out, ",\"watches\":%" PRIu64",\"trail\":%" PRIu64",\"var_data\":%" PRIu64, watch_bytes, trail_bytes, var_bytes);
+    appendf(out, ",\"rss_mb\":%.2f,\"peak_mb\":%.2f}", memUsed(), memUsedPeak());
+
+    appendf(out, ",\"rates\":{\"conflicts\":%.1f,\"decisions\":%.1f,\"propagations\":%.1f",
+            rate(conflicts, cpu_time), rate(decisions, cpu_time), rate(propagations, cpu_time));
+    appendf(out, ",\"interval\":%.3f,\"interval_conflicts\":%.1f,\"interval_decisions\":%.1f,\"interval_propagations\":%.1f}",
+            interval, rate(conflicts - stats_last_confl, interval), rate(decisions - stats_last_dec, interval),
+            rate(propagations - stats_last_props, interval));
+    if (telemetry){
+        appendf(out, ",\"telemetry\":{");
+        appendHistogram(out, "size",     hist_size);     appendf(out, ",");
+        appendHistogram(out, "lbd",      hist_lbd);      appendf(out, ",");
+        appendHistogram(out, "backjump", hist_backjump); appendf(out, ",");
+        appendHistogram(out, "lifetime", hist_lifetime);
+        appendf(out, "}");
+    }
+    appendf(out, "}\n");
+
+    // Short writes are retried; any other error silently disables the stream:
+    for (int written = 0; written < out.size(); ){
+        ssize_t n = write(stats_fd, (const char*)out + written, out.size() - written);
+        if (n <= 0){ stats_fd = -1; break; }
+        written += n;
+    }
+
+    resetStatsStream();
 }
 
 
@@ -1026,21 +1822,51 @@ void Solver::relocAll(ClauseAllocator& to)
 
         // Note: it is not safe to call 'locked()' on a relocated clause. This is why we keep
         // 'dangling' reasons here. It is safe and does not hurt.
-        if (reason(v) != CRef_Undef && (ca[reason(v)].reloced() || locked(ca[reason(v)]))){
+        if (reason(v) != CRef_Undef && reason(v) != CRef_Lazy && (ca[reason(v)].reloced() || locked(ca[reason(v)]))){
             assert(!isRemoved(reason(v)));
             ca.reloc(vardata[v].reason, to);
         }
     }
 
+    // All explained reasons and conflicts of propagators:
+    //
+    for (int i = 0; i < prop_clauses.size(); i++)
+        ca.reloc(prop_clauses[i], to);
+
     // All learnt:
     //
+    // (the telemetry birth map is keyed by clause reference and must follow the relocation)
+    CMap<uint64_t> births;
     int i, j;
     for (i = j = 0; i < learnts.size(); i++)
         if (!isRemoved(learnts[i])){
+            CRef     old = learnts[i];
+            uint64_t birth;
             ca.reloc(learnts[i], to);
+            if (telemetry && learnt_birth.has(old, birth))
+                births.insert(learnts[i], birth);
             learnts[j++] = learnts[i];
         }
     learnts.shrink(i - j);
+    if (telemetry) births.moveTo(learnt_birth);
+
+    // All external:
+    //
+    for (i = j = 0; i < externals.size(); i++)
+        if (!isRemoved(externals[i])){
+            ca.reloc(externals[i], to);
+            externals[j++] = externals[i];
+        }
+    externals.shrink(i - j);
+
+    // All clauses of permanent propagators:
+    //
+    for (i = j = 0; i < prop_permanent.size(); i++)
+        if (!isRemoved(prop_permanent[i])){
+            ca.reloc(prop_permanent[i], to);
+            prop_permanent[j++] = prop_permanent[i];
+        }
+    prop_permanent.shrink(i - j);
 
     // All original:
     //
@@ -1095,7 +1921,7 @@ extern "C" {
   PropLits propagate(void* sms_solver) {
     Solver* s = (Solver*) sms_solver;
     s->cflr = s->propagate();
-    int num_prop_lits = s->nAssigns() - s->trail_lim.last();
+    int num_prop_lits = s->nAssigns() - (s->decisionLevel() > 0 ? s->trail_lim.last() : 0);
     if (s->cflr != CRef_Undef) {
       return {CONFLICT, num_prop_lits};
     } else if (s->nAssigns() == s->nVars()) {
@@ -1136,13 +1962,250 @@ extern "C" {
     return 0;
   }
 
+  void set_stats_stream(void* sms_solver, int fd, int confl_interval, double time_interval) {
+    Solver* s = (Solver*) sms_solver;
+    s->stats_fd       = fd;
+    s->stats_confl    = confl_interval;
+    s->stats_interval = time_interval;
+    s->resetStatsStream();
+  }
+
+  void write_stats(void* sms_solver) {
+    ((Solver*) sms_solver)->writeStats("user");
+  }
+
+  // Deterministic budgets: 'ticks' counts watcher and clause visits, so a limit expressed in
+  // ticks stops at the same point of the search on every machine.
+
+  void set_tick_budget(void* sms_solver, long long ticks) {
+    Solver* s = (Solver*) sms_solver;
+    if (ticks < 0)
+      s->tick_budget = -1;
+    else
+      s->setTickBudget(ticks);
+  }
+
+  unsigned long long get_ticks(void* sms_solver) {
+    return ((Solver*) sms_solver)->ticks;
+  }
+
+  int within_budget(void* sms_solver) {
+    return ((Solver*) sms_solver)->withinBudget();
+  }
+
+  // wall-clock deadline 'milliseconds' from now (negative: no deadline). Checked every few
+  // thousand propagations, both during 'solve_limited' and step-by-step propagation; poll
+  // 'within_budget' to find out whether it has passed.
+  void set_time_budget(void* sms_solver, double milliseconds) {
+    Solver* s = (Solver*) sms_solver;
+    if (milliseconds < 0) {
+      s->time_budget = -1;
+      s->time_out = false;
+    } else
+      s->setTimeBudget(milliseconds / 1000);
+  }
+
+  // cardinality and pseudo-Boolean constraints over DIMACS literals, added at the root level like
+  // clauses; the return value is 0 if the formula became unsatisfiable
+
+  static void card_lits(Solver* s, const int* lits, int num_lits, vec<Lit>& out) {
+    for (int i = 0; i < num_lits; i++) {
+      Var v = abs(lits[i]) - 1;
+      while (v >= s->nVars())
+        s->newVar();
+      out.push(s->i2l(lits[i]));
+    }
+  }
+
+  int add_at_most(void* sms_solver, const int* lits, int num_lits, int k) {
+    Solver* s = (Solver*) sms_solver;
+    vec<Lit> ps;
+    card_lits(s, lits, num_lits, ps);
+    return s->addAtMost(ps, k);
+  }
+
+  int add_at_least(void* sms_solver, const int* lits, int num_lits, int k) {
+    Solver* s = (Solver*) sms_solver;
+    vec<Lit> ps;
+    card_lits(s, lits, num_lits, ps);
+    return s->addAtLeast(ps, k);
+  }
+
+  // 'sum coefs[i] * lits[i] >= bound'; coefficients may be negative. Returns -1 (adding nothing)
+  // if the absolute values of the coefficients and the bound sum up to more than INT64_MAX
+  int add_pb(void* sms_solver, const int* lits, const long long* coefs, int num_lits, long long bound) {
+    Solver* s = (Solver*) sms_solver;
+    vec<Lit> ps;
+    vec<int64_t> cs;
+    for (int i = 0; i < num_lits; i++)
+      cs.push(coefs[i]);
+    if (!Solver::pbFits(cs, bound))
+      return -1;
+    card_lits(s, lits, num_lits, ps);
+    return s->addPb(ps, cs, bound);
+  }
+
+  // native canonicity check of an n-vertex graph; 'edge_lits[i*n+j]' is the DIMACS literal of
+  // the edge between i and j (symmetric, the diagonal is ignored)
+  int add_canonicity(void* sms_solver, int n, const int* edge_lits) {
+    Solver* s = (Solver*) sms_solver;
+    vec<Lit> edges;
+    for (int i = 0; i < n * n; i++) {
+      if (i / n == i % n) {
+        edges.push(lit_Undef);
+        continue;
+      }
+      int lit = edge_lits[i];
+      Var v = abs(lit) - 1;
+      while (v >= s->nVars())
+        s->newVar();
+      edges.push(s->i2l(lit));
+    }
+    return s->addCanonicity(n, edges);
+  }
+
+  // native connectivity of an n-vertex graph; 'edge_lits[i*n+j]' is the DIMACS literal of the
+  // edge between i and j, or 0 if they are never adjacent (symmetric, the diagonal is ignored)
+  int add_connectivity(void* sms_solver, int n, const int* edge_lits) {
+    Solver* s = (Solver*) sms_solver;
+    vec<Lit> edges;
+    for (int i = 0; i < n * n; i++) {
+      int lit = edge_lits[i];
+      if (i / n == i % n || lit == 0) {
+        edges.push(lit_Undef);
+        continue;
+      }
+      Var v = abs(lit) - 1;
+      while (v >= s->nVars())
+        s->newVar();
+      edges.push(s->i2l(lit));
+    }
+    return s->addConnectivity(n, edges);
+  }
+
+  // native acyclicity of an n-vertex directed graph; 'arc_lits[i*n+j]' is the DIMACS literal of
+  // the arc from i to j, or 0 if there is none (loops on the diagonal are set false)
+  int add_acyclicity(void* sms_solver, int n, const int* arc_lits) {
+    Solver* s = (Solver*) sms_solver;
+    vec<Lit> arcs;
+    for (int i = 0; i < n * n; i++) {
+      int lit = arc_lits[i];
+      if (lit == 0) {
+        arcs.push(lit_Undef);
+        continue;
+      }
+      Var v = abs(lit) - 1;
+      while (v >= s->nVars())
+        s->newVar();
+      arcs.push(s->i2l(lit));
+    }
+    return s->addAcyclicity(n, arcs);
+  }
+
+  // external propagation with lazy explanations: 'imply_lazy' implies a literal at the current
+  // decision level without a reason clause and propagates it. Only when conflict analysis needs
+  // the reason is 'explain' called with the literal; it adds the other (false) literals of the
+  // reason clause with 'add_reason_literal'. Implying a false literal is a conflict, explained
+  // right away.
+
+  // calling it again replaces the callback (which then also explains the literals implied before)
+  void set_explain_callback(void* sms_solver, void (*explain)(void* data, int lit), void* data) {
+    Solver* s = (Solver*) sms_solver;
+    if (s->external != NULL) {
+      s->external->setCallback(explain, data);
+      return;
+    }
+    s->external = new ExternalPropagator(explain, data);
+    s->addPropagator(s->external);
+  }
+
+  PropLits imply_lazy(void* sms_solver, int literal) {
+    Solver* s = (Solver*) sms_solver;
+    assert(s->external != NULL);
+    Lit p = s->i2l(literal);
+    while (var(p) >= s->nVars())
+      s->newVar();
+    if (!s->external->imply(*s, p)) {
+      vec<Lit> c;
+      s->external->explain(*s, p, c);
+      s->cflr = s->propagatorConflict(c, s->external);
+      return {CONFLICT, s->nAssigns() - (s->decisionLevel() > 0 ? s->trail_lim.last() : 0)};
+    }
+    return propagate(sms_solver);
+  }
+
+  void add_reason_literal(void* sms_solver, int literal) {
+    Solver* s = (Solver*) sms_solver;
+    s->external->addReason(s->i2l(literal));
+  }
+
+  // irredundant clauses added during search (e.g. symmetry breaking clauses), kept apart from the
+  // problem and learnt clauses. The solver first backtracks to the level at which the clause
+  // becomes unit, or false if two of its literals are false at the highest level (see
+  // 'decision_level'); a false clause is the conflict for
+  // 'learn_clause', a unit one is propagated.
+  PropLits add_external_clause(void* sms_solver, const int* lits, int num_lits) {
+    Solver* s = (Solver*) sms_solver;
+    vec<Lit> ps;
+    card_lits(s, lits, num_lits, ps);
+    s->cflr = s->addExternalClause(ps);
+    if (s->cflr != CRef_Undef || !s->okay())
+      return {CONFLICT, s->nAssigns() - (s->decisionLevel() > 0 ? s->trail_lim.last() : 0)};
+    return propagate(sms_solver);
+  }
+
+  int decision_level(void* sms_solver) {
+    return ((Solver*) sms_solver)->decisionLevel();
+  }
+
+  // clauses that can be removed again by their handle, at the root level. They are enforced by
+  // 'solve_limited' (which assumes their activation literals), not by step-by-step propagation.
+  int add_removable_clause(void* sms_solver, const int* lits, int num_lits) {
+    Solver* s = (Solver*) sms_solver;
+    vec<Lit> ps;
+    card_lits(s, lits, num_lits, ps);
+    return s->addRemovableClause(ps);
+  }
+
+  void remove_clause(void* sms_solver, int handle) {
+    ((Solver*) sms_solver)->dropClause(handle);
+  }
+
+  // clauses added with 'add' between 'push_scope' and the matching 'pop_scope' are removed again,
+  // together with the clauses learnt from them (enforced by 'solve_limited', like removable ones)
+  void push_scope(void* sms_solver) {
+    ((Solver*) sms_solver)->push();
+  }
+
+  void pop_scope(void* sms_solver) {
+    ((Solver*) sms_solver)->pop();
+  }
+
+  // runs CDCL search from the root level until the formula is decided or the budget runs out
+  PropResult solve_limited(void* sms_solver) {
+    Solver* s = (Solver*) sms_solver;
+    vec<Lit> no_assumps;
+    s->cancelUntil(0);
+    s->cflr = CRef_Undef;
+    lbool ret = s->solveLimited(no_assumps);
+    return ret == l_True ? SAT : ret == l_False ? CONFLICT : OPEN;
+  }
+
   PropLits learn_clause(void* sms_solver) {
     Solver* s = (Solver*) sms_solver;
     if (s->cflr == CRef_Undef) {
       return {OPEN, 0};
     }
+    // a late conflict of a propagator is analyzed at the highest level of its literals; if that is
+    // the root level, the formula is unsatisfiable
+    if (s->conflictLevel(s->cflr) < s->decisionLevel())
+      s->cancelUntil(s->conflictLevel(s->cflr));
+    if (s->decisionLevel() == 0) {
+      return {CONFLICT, 0};
+    }
     s->lrncls.clear();
     s->analyze(s->cflr, s->lrncls, s->btlev);
+    if (s->telemetry) s->recordLearnt(s->lrncls, s->btlev);
     s->cancelUntil(s->btlev);
 
     if (s->lrncls.size() == 1) {
@@ -1153,6 +2216,7 @@ extern "C" {
       s->learnts.push(cr);
       s->attachClause(cr);
       s->claBumpActivity(s->ca[cr]);
+      if (s->telemetry) s->learnt_birth.insert(cr, s->conflicts);
       s->uncheckedEnqueue(s->lrncls[0], cr);
       return propagate(sms_solver);
     }
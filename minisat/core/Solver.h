@@ -26,12 +26,23 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "minisat/mtl/Alg.h"
 #include "minisat/mtl/IntMap.h"
 #include "minisat/utils/Options.h"
+#include "minisat/utils/System.h"
+#include "minisat/utils/Histogram.h"
 #include "minisat/core/SolverTypes.h"
+#include "minisat/core/Propagator.h"
 #include <vector>
 
 
 namespace Minisat {
 
+class CardPropagator;
+class AmoPropagator;
+class PbPropagator;
+class CanonPropagator;
+class ConnectPropagator;
+class AcyclicPropagator;
+class ExternalPropagator;
+
 //=================================================================================================
 // Solver -- the main class:
 
@@ -45,8 +56,8 @@ public:
 
     // Problem specification:
     //
-    Var     newVar    (lbool upol = l_Undef, bool dvar = true); // Add a new variable with parameters specifying variable mode.
-    void    releaseVar(Lit l);                                  // Make literal true and promise to never refer to variable again.
+    virtual Var  newVar    (lbool upol = l_Undef, bool dvar = true); // Add a new variable with parameters specifying variable mode.
+    virtual void releaseVar(Lit l);                             // Make literal true and promise to never refer to variable again.
 																//
     vec<Lit> tmp_clause;		                                // collect literals 1 by 1 for a clause to be added
 
@@ -71,8 +82,33 @@ public:
     bool    addClause (Lit p, Lit q);                           // Add a binary clause to the solver. 
     bool    addClause (Lit p, Lit q, Lit r);                    // Add a ternary clause to the solver. 
     bool    addClause (Lit p, Lit q, Lit r, Lit s);             // Add a quaternary clause to the solver. 
-    bool    addClause_(      vec<Lit>& ps);                     // Add a clause to the solver without making superflous internal copy. Will
+    virtual bool addClause_(vec<Lit>& ps);                      // Add a clause to the solver without making superflous internal copy. Will
                                                                 // change the passed vector 'ps'.
+    virtual bool addAtMost (const vec<Lit>& ps, int k);         // Add the constraint that at most 'k' of the (distinct) literals are true.
+    virtual bool addAtLeast(const vec<Lit>& ps, int k);         // Add the constraint that at least 'k' of the (distinct) literals are true.
+    virtual bool addPb     (const vec<Lit>& ps, const vec<int64_t>& cs, int64_t bound); // Add the constraint 'sum cs[i] * ps[i] >= bound'. Returns FALSE,
+                                                                // adding nothing, if the numbers do not fit (see 'pbFits()').
+    static  bool pbFits    (const vec<int64_t>& cs, int64_t bound); // Whether the sum of the absolute values of 'cs' and 'bound' fits in 'int64_t'.
+    virtual bool addCanonicity(int n, const vec<Lit>& edges);   // Restrict the graph with adjacency matrix 'edges' ('n*n') to canonical ones (see 'Canon.h').
+    virtual bool addConnectivity(int n, const vec<Lit>& edges); // Require the graph with adjacency matrix 'edges' to be connected (see 'Connect.h').
+    virtual bool addAcyclicity  (int n, const vec<Lit>& arcs);  // Require the directed graph with adjacency matrix 'arcs' to be acyclic (see 'Acyclic.h').
+    virtual CRef addExternalClause(const vec<Lit>& ps);         // Add an irredundant clause at any decision level, kept apart from the problem clauses
+                                                                // ('externals'). Returns it if it is still false after backtracking, CRef_Undef otherwise.
+    virtual int  addRemovableClause(const vec<Lit>& ps);        // Add a clause that 'dropClause()' can remove again, and return its handle.
+    void    dropClause(int handle);                             // Remove a removable clause, and all learnt clauses derived from it.
+
+    // Scopes: clauses added by 'addClause()' after 'push()' are removed again by the matching 'pop()'
+    // (other constraints are not scoped):
+    //
+    virtual void push();                                        // Open a scope.
+    void    pop      ();                                        // Close the innermost scope and remove its clauses and the learnt clauses derived from them.
+    int     nScopes  ()      const;                             // The number of open scopes.
+
+    // Propagators (see 'Propagator.h', not owned by the solver):
+    //
+    void    addPropagator(Propagator* pr);                      // Register a propagator.
+    void    watchLit     (Lit p, Propagator* pr);               // Notify 'pr' whenever 'p' becomes true.
+    bool    enqueueLazy  (Lit p, Propagator* from);             // Imply 'p' with a reason to be explained by 'from'. FALSE if 'p' is false.
 
     // Solving:
     //
@@ -117,14 +153,18 @@ public:
     int     nAssigns   ()      const;       // The current number of assigned literals.
     int     nClauses   ()      const;       // The current number of original clauses.
     int     nLearnts   ()      const;       // The current number of learnt clauses.
+    int     nExternals ()      const;       // The current number of external clauses.
     int     nVars      ()      const;       // The current number of variables.
     int     nFreeVars  ()      const;
     void    printStats ()      const;       // Print some current statistics to standard output.
+    void    writeStats (const char* event, lbool status = l_Undef); // Write current statistics as one JSON line to 'stats_fd'.
 
     // Resource contraints:
     //
     void    setConfBudget(int64_t x);
     void    setPropBudget(int64_t x);
+    void    setTickBudget(int64_t x);  // Budget in ticks (watcher and clause visits), reproducible across machines.
+    void    setTimeBudget(double secs);// Wall-clock deadline 'secs' from now. Set it before each 'solveLimited()' call.
     void    budgetOff();
     void    interrupt();          // Trigger a (potentially asynchronous) interruption of the solver.
     void    clearInterrupt();     // Clear interrupt indicator flag.
@@ -155,6 +195,8 @@ public:
     bool      rnd_init_act;       // Initialize variable activities with a small random value.
     double    garbage_frac;       // The fraction of wasted memory allowed before a garbage collection is triggered.
     int       min_learnts_lim;    // Minimum number to set the learnts limit to.
+    bool      ext_demote;         // Demote external clauses not used in conflict analysis between reductions to learnt ones. (default false)
+                                  // Only for clauses the models need not satisfy, e.g. symmetry breaking.
 
     int       restart_first;      // The initial restart limit.                                                                (default 100)
     double    restart_inc;        // The factor with which the restart limit is multiplied in each restart.                    (default 1.5)
@@ -164,10 +206,31 @@ public:
     int       learntsize_adjust_start_confl;
     double    learntsize_adjust_inc;
 
+    int       stats_fd;           // If non-negative, periodic statistics are written to this file descriptor as JSON lines.
+    int       stats_confl;        // Write statistics every this many conflicts (0 = never).                                  (default 0)
+    double    stats_interval;     // Write statistics every this many seconds of CPU time (0 = never).                        (default 1)
+    bool      telemetry;          // Collect histograms of learnt clause size, LBD, backjump distance and lifetime.          (default false)
+
+    int       inprocess_confl;    // Call 'inprocess()' between restarts every this many conflicts (growing, 0 = never).    (default 0)
+    double    inprocess_effort;   // Effort of each round relative to the search ticks since the previous one.              (default 0.1)
+
+    int       time_check_interval;// Read the clock for the deadline of 'setTimeBudget()' every this many propagations.   (default 1000)
+
+    int       canon_cutoff;       // Search nodes per canonicity check of a partial graph.                                   (default 20000)
+    int       canon_freq;         // Check the canonicity of partial graphs at every this many propagation fixpoints.       (default 20)
+    int       canon_cache;        // Remember the canonicity checks of 2^this many partial graphs (0 = off).               (default 16)
+
     // Statistics: (read-only member variable)
     //
     uint64_t solves, starts, decisions, rnd_decisions, propagations, conflicts;
+    uint64_t inprocessings;
+    uint64_t ticks;               // Deterministic work measure: watchers scanned and clauses visited in 'propagate()' and 'analyze()'.
     uint64_t dec_vars, num_clauses, num_learnts, clauses_literals, learnts_literals, max_literals, tot_literals;
+    uint64_t num_externals, externals_literals, ext_demoted;
+
+    // Learnt clause telemetry: (read-only member variable, only maintained if 'telemetry' is set)
+    //
+    Histogram hist_size, hist_lbd, hist_backjump, hist_lifetime; // Lifetime is measured in conflicts until deletion by 'reduceDB()'.
 
 public:
 
@@ -213,9 +276,14 @@ public:
     //
     vec<CRef>           clauses;          // List of problem clauses.
     vec<CRef>           learnts;          // List of learnt clauses.
+    vec<CRef>           externals;        // List of external clauses (irredundant, added by the user during search). They are
+                                          // allocated as learnt, for the activity, and never deleted by 'reduceDB()'.
     vec<Lit>            trail;            // Assignment stack; stores all assigments made in the order they were made.
     vec<int>            trail_lim;        // Separator indices for different decision levels in 'trail'.
     vec<Lit>            assumptions;      // Current set of assumptions provided to solve by the user.
+    vec<Var>            removable_act;    // Activation variable of each removable clause handle (var_Undef if dropped). Clause 'C'
+    vec<int>            free_handles;     // is added as 'C | a', and 'solve_()' assumes '~a'; dropping it releases 'a'.
+    vec<Var>            scope_act;        // Activation variable of each open scope, guarding its clauses in the same way.
 
     VMap<double>        activity;         // A heuristic measurement of the activity of a variable.
     VMap<lbool>         assigns;          // The current assignments.
@@ -251,15 +319,56 @@ public:
     vec<Lit>            add_tmp;
 
     double              max_learnts;
+    uint64_t            next_inprocess;     // Conflict count at which the next inprocessing round is due.
+    uint64_t            inprocess_ticks;    // Value of 'ticks' at the end of the previous inprocessing round.
     double              learntsize_adjust_confl;
     int                 learntsize_adjust_cnt;
 
+    // Statistics stream:
+    //
+    uint64_t            stats_next_confl;   // Conflict count at which the next statistics line is due.
+    double              stats_next_time;    // CPU time at which the next statistics line is due.
+    double              stats_last_time;    // CPU time, conflicts, decisions and propagations at the time of the
+    uint64_t            stats_last_confl;   // previous statistics line (used to compute interval rates).
+    uint64_t            stats_last_dec;
+    uint64_t            stats_last_props;
+
+    // Learnt clause telemetry:
+    //
+    CMap<uint64_t>      learnt_birth;       // Conflict count at which each learnt clause was created.
+    vec<uint64_t>       lbd_stamp;          // Per decision level: last value of 'lbd_counter' that counted the level.
+    uint64_t            lbd_counter;
+
     // Resource contraints:
     //
     int64_t             conflict_budget;    // -1 means no budget.
     int64_t             propagation_budget; // -1 means no budget.
+    int64_t             tick_budget;        // -1 means no budget.
+    double              time_budget;        // Deadline in 'realTime()' seconds, negative means no budget.
+    int                 time_check_props;   // Propagations remaining until the clock is read again.
+    bool                time_out;           // Set by 'propagate()' once the deadline has passed.
     bool                asynch_interrupt;
 
+    // Propagators:
+    //
+    vec<Propagator*>    propagators;
+    vec<vec<Propagator*> >
+                        prop_watches;       // 'prop_watches[toInt(p)]' lists the propagators to notify when 'p' becomes true.
+    VMap<Propagator*>   prop_reason;        // The propagator that implied a variable with reason 'CRef_Lazy'.
+    int                 prop_qhead;         // Head of the queue of literals to notify propagators about (index into 'trail').
+    vec<CRef>           prop_clauses;       // Explained reasons and conflicts of propagators, and the decision level at
+    vec<int>            prop_levels;        // which they are freed again by backtracking.
+    vec<CRef>           prop_permanent;     // Clauses of permanent propagators. They are allocated as learnt, and never deleted
+                                            // by 'reduceDB()'.
+    vec<Lit>            prop_tmp;
+    CardPropagator*     cards;              // Cardinality constraints (created by the first 'addAtMost()').
+    AmoPropagator*      amos;               // At-most-one constraints (created by the first 'addAtMost()' with 'k = 1').
+    PbPropagator*       pbs;                // Pseudo-Boolean constraints (created by the first 'addPb()').
+    vec<CanonPropagator*> canons;           // Canonicity of graphs (one per 'addCanonicity()').
+    vec<ConnectPropagator*> connects;       // Connectivity of graphs (one per 'addConnectivity()').
+    vec<AcyclicPropagator*> acyclics;       // Acyclicity of directed graphs (one per 'addAcyclicity()').
+    ExternalPropagator* external;           // Lazily explained implications of the C interface (created by 'set_explain_callback()').
+
     // Main internal methods:
     //
     void     insertVarOrder   (Var x);                                                 // Insert a variable in the decision order priority queue.
@@ -268,15 +377,23 @@ public:
     void     uncheckedEnqueue (Lit p, CRef from = CRef_Undef);                         // Enqueue a literal. Assumes value of literal is undefined.
     bool     enqueue          (Lit p, CRef from = CRef_Undef);                         // Test if fact 'p' contradicts current state, enqueue otherwise.
     CRef     propagate        ();                                                      // Perform unit propagation. Returns possibly conflicting clause.
+    CRef     propagateClauses ();                                                      // Unit propagation over the clauses only.
+    CRef     propagatorConflict(vec<Lit>& c, Propagator* from);                        // Turn the conflict of a propagator into a clause.
+    CRef     propagatorClause (const vec<Lit>& c, Propagator* from, int level);        // Allocate a conflict or reason of a propagator.
     void     cancelUntil      (int level);                                             // Backtrack until a certain level.
+    int      conflictLevel    (CRef confl) const;                                      // Highest decision level among the literals of a conflict.
     void     analyze          (CRef confl, vec<Lit>& out_learnt, int& out_btlevel);    // (bt = backtrack)
     void     analyzeFinal     (Lit p, LSet& out_conflict);                             // COULD THIS BE IMPLEMENTED BY THE ORDINARIY "analyze" BY SOME REASONABLE GENERALIZATION?
     bool     litRedundant     (Lit p);                                                 // (helper method for 'analyze()')
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
+    virtual bool inprocess    ();                                                      // Simplify between restarts (at level 0). Returns FALSE if UNSAT.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
     void     rebuildOrderHeap ();
+    void     resetStatsStream ();                                                      // Schedule the next statistics line relative to now.
+    int      computeLBD       (const vec<Lit>& c);                                     // Number of distinct decision levels in 'c'.
+    void     recordLearnt     (const vec<Lit>& c, int btlevel);                        // Update telemetry for a clause returned by 'analyze()'.
 
     // Maintaining Variable/Clause activity:
     //
@@ -300,10 +417,14 @@ public:
     int      decisionLevel    ()      const; // Gives the current decisionlevel.
     uint32_t abstractLevel    (Var x) const; // Used to represent an abstraction of sets of decision levels.
     CRef     reason           (Var x) const;
+    CRef     reasonClause     (Var x);       // Like 'reason()', but lazy reasons are explained and turned into clauses.
+    CRef     lazyReason       (Var x);
     int      level            (Var x) const;
     double   progressEstimate ()      const; // DELETE THIS ?? IT'S NOT VERY USEFUL ...
     bool     withinBudget     ()      const;
+    bool     deadlinePassed   ();            // Read the clock now and set 'time_out' if the deadline has passed.
     void     relocAll         (ClauseAllocator& to);
+    bool     addScoped        (vec<Lit>& ps);     // Add a clause of the user, guarded by the innermost scope.
 
     // Static helpers:
     //
@@ -326,6 +447,7 @@ public:
 
 inline CRef Solver::reason(Var x) const { return vardata[x].reason; }
 inline int  Solver::level (Var x) const { return vardata[x].level; }
+inline CRef Solver::reasonClause(Var x)  { CRef r = reason(x); return r == CRef_Lazy ? lazyReason(x) : r; }
 
 inline void Solver::insertVarOrder(Var x) {
     if (!order_heap.inHeap(x) && decision[x]) order_heap.insert(x); }
@@ -349,6 +471,10 @@ inline void Solver::claBumpActivity (Clause& c) {
             // Rescale:
             for (int i = 0; i < learnts.size(); i++)
                 ca[learnts[i]].activity() *= 1e-20;
+            for (int i = 0; i < externals.size(); i++)
+                ca[externals[i]].activity() *= 1e-20;
+            for (int i = 0; i < prop_permanent.size(); i++)
+                ca[prop_permanent[i]].activity() *= 1e-20;
             cla_inc *= 1e-20; } }
 
 inline void Solver::checkGarbage(void){ return checkGarbage(garbage_frac); }
@@ -358,17 +484,29 @@ inline void Solver::checkGarbage(double gf){
 
 // NOTE: enqueue does not set the ok flag! (only public methods do)
 inline bool     Solver::enqueue         (Lit p, CRef from)      { return value(p) != l_Undef ? value(p) != l_False : (uncheckedEnqueue(p, from), true); }
-inline bool     Solver::addClause       (const vec<Lit>& ps)    { ps.copyTo(add_tmp); return addClause_(add_tmp); }
-inline bool     Solver::addEmptyClause  ()                      { add_tmp.clear(); return addClause_(add_tmp); }
-inline bool     Solver::addClause       (Lit p)                 { add_tmp.clear(); add_tmp.push(p); return addClause_(add_tmp); }
-inline bool     Solver::addClause       (Lit p, Lit q)          { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); return addClause_(add_tmp); }
-inline bool     Solver::addClause       (Lit p, Lit q, Lit r)   { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); return addClause_(add_tmp); }
-inline bool     Solver::addClause       (Lit p, Lit q, Lit r, Lit s){ add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); add_tmp.push(s); return addClause_(add_tmp); }
+inline bool     Solver::addScoped       (vec<Lit>& ps)          { if (scope_act.size() > 0) ps.push(mkLit(scope_act.last())); return addClause_(ps); }
+inline bool     Solver::addClause       (const vec<Lit>& ps)    { ps.copyTo(add_tmp); return addScoped(add_tmp); }
+inline bool     Solver::addEmptyClause  ()                      { add_tmp.clear(); return addScoped(add_tmp); }
+inline bool     Solver::addClause       (Lit p)                 { add_tmp.clear(); add_tmp.push(p); return addScoped(add_tmp); }
+inline bool     Solver::addClause       (Lit p, Lit q)          { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); return addScoped(add_tmp); }
+inline bool     Solver::addClause       (Lit p, Lit q, Lit r)   { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); return addScoped(add_tmp); }
+inline bool     Solver::addClause       (Lit p, Lit q, Lit r, Lit s){ add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); add_tmp.push(s); return addScoped(add_tmp); }
 
 inline bool     Solver::isRemoved       (CRef cr)         const { return ca[cr].mark() == 1; }
-inline bool     Solver::locked          (const Clause& c) const { return value(c[0]) == l_True && reason(var(c[0])) != CRef_Undef && ca.lea(reason(var(c[0]))) == &c; }
+inline bool     Solver::locked          (const Clause& c) const {
+    CRef r = reason(var(c[0])); return value(c[0]) == l_True && r != CRef_Undef && r != CRef_Lazy && ca.lea(r) == &c; }
+inline bool     Solver::inprocess       ()                      { return true; }
 inline void     Solver::newDecisionLevel()                      { trail_lim.push(trail.size()); }
 
+inline void     Solver::addPropagator   (Propagator* pr)        { propagators.push(pr); }
+inline void     Solver::watchLit        (Lit p, Propagator* pr) { prop_watches[toInt(p)].push(pr); }
+inline bool     Solver::enqueueLazy     (Lit p, Propagator* from){
+    if (value(p) != l_Undef) return value(p) == l_True;
+    uncheckedEnqueue(p, CRef_Lazy);
+    prop_reason[var(p)] = from;
+    if (from->permanent()) lazyReason(var(p));
+    return true; }
+
 inline int      Solver::decisionLevel ()      const   { return trail_lim.size(); }
 inline uint32_t Solver::abstractLevel (Var x) const   { return 1 << (level(x) & 31); }
 inline lbool    Solver::value         (Var x) const   { return assigns[x]; }
@@ -378,6 +516,8 @@ inline lbool    Solver::modelValue    (Lit p) const   { return model[var(p)] ^ s
 inline int      Solver::nAssigns      ()      const   { return trail.size(); }
 inline int      Solver::nClauses      ()      const   { return num_clauses; }
 inline int      Solver::nLearnts      ()      const   { return num_learnts; }
+inline int      Solver::nExternals    ()      const   { return num_externals; }
+inline int      Solver::nScopes       ()      const   { return scope_act.size(); }
 inline int      Solver::nVars         ()      const   { return next_var; }
 // TODO: nFreeVars() is not quite correct, try to calculate right instead of adapting it like below:
 inline int      Solver::nFreeVars     ()      const   { return (int)dec_vars - (trail_lim.size() == 0 ? trail.size() : trail_lim[0]); }
@@ -392,13 +532,20 @@ inline void     Solver::setDecisionVar(Var v, bool b)
 }
 inline void     Solver::setConfBudget(int64_t x){ conflict_budget    = conflicts    + x; }
 inline void     Solver::setPropBudget(int64_t x){ propagation_budget = propagations + x; }
+inline void     Solver::setTickBudget(int64_t x){ tick_budget        = ticks        + x; }
 inline void     Solver::interrupt(){ asynch_interrupt = true; }
 inline void     Solver::clearInterrupt(){ asynch_interrupt = false; }
-inline void     Solver::budgetOff(){ conflict_budget = propagation_budget = -1; }
+inline void     Solver::setTimeBudget(double secs){ time_budget = realTime() + secs; time_check_props = 0; time_out = secs <= 0; }
+inline void     Solver::budgetOff(){ conflict_budget = propagation_budget = tick_budget = -1; time_budget = -1; time_out = false; }
+inline bool     Solver::deadlinePassed(){
+    if (time_budget >= 0 && !time_out && realTime() >= time_budget)
+        time_out = true;
+    return time_out; }
 inline bool     Solver::withinBudget() const {
-    return !asynch_interrupt &&
+    return !asynch_interrupt && !time_out &&
            (conflict_budget    < 0 || conflicts < (uint64_t)conflict_budget) &&
-           (propagation_budget < 0 || propagations < (uint64_t)propagation_budget); }
+           (propagation_budget < 0 || propagations < (uint64_t)propagation_budget) &&
+           (tick_budget        < 0 || ticks        < (uint64_t)tick_budget); }
 
 // FIXME: after the introduction of asynchronous interrruptions the solve-versions that return a
 // pure bool do not give a safe interface. Either interrupts must be possible to turn off here, or
@@ -449,6 +596,28 @@ extern "C" {
   PropLits assign_literal(void* solver, int literal);
   int backtrack(void* solver, int num_dec_levels);
   PropLits learn_clause(void* sms_solver);
+  void set_stats_stream(void* sms_solver, int fd, int confl_interval, double time_interval);
+  void write_stats(void* sms_solver);
+  void set_tick_budget(void* sms_solver, long long ticks);
+  unsigned long long get_ticks(void* sms_solver);
+  int within_budget(void* sms_solver);
+  PropResult solve_limited(void* sms_solver);
+  void set_time_budget(void* sms_solver, double milliseconds);
+  int add_at_most(void* sms_solver, const int* lits, int num_lits, int k);
+  int add_at_least(void* sms_solver, const int* lits, int num_lits, int k);
+  int add_pb(void* sms_solver, const int* lits, const long long* coefs, int num_lits, long long bound);
+  int add_canonicity(void* sms_solver, int n, const int* edge_lits);
+  int add_connectivity(void* sms_solver, int n, const int* edge_lits);
+  int add_acyclicity(void* sms_solver, int n, const int* arc_lits);
+  void set_explain_callback(void* sms_solver, void (*explain)(void* data, int lit), void* data);
+  PropLits imply_lazy(void* sms_solver, int literal);
+  void add_reason_literal(void* sms_solver, int literal);
+  PropLits add_external_clause(void* sms_solver, const int* lits, int num_lits);
+  int decision_level(void* sms_solver);
+  int add_removable_clause(void* sms_solver, const int* lits, int num_lits);
+  void remove_clause(void* sms_solver, int handle);
+  void push_scope(void* sms_solver);
+  void pop_scope(void* sms_solver);
 }
 
 #endif
@@ -142,7 +142,8 @@ class Clause {
         unsigned learnt    : 1;
         unsigned has_extra : 1;
         unsigned reloced   : 1;
-        unsigned size      : 27; }                        header;
+        unsigned external  : 1;
+        unsigned size      : 26; }                        header;
     union { Lit lit; float act; uint32_t abs; CRef rel; } data[0];
 
     friend class ClauseAllocator;
@@ -153,6 +154,7 @@ class Clause {
         header.learnt    = learnt;
         header.has_extra = use_extra;
         header.reloced   = 0;
+        header.external  = 0;
         header.size      = ps.size();
 
         for (int i = 0; i < ps.size(); i++) 
@@ -177,24 +179,37 @@ class Clause {
         if (header.has_extra){
             if (header.learnt)
                 data[header.size].act = from.data[header.size].act;
-            else 
-                data[header.size].abs = from.data[header.size].abs;
+            else if (from.header.has_extra){
+                data[header.size].abs   = from.data[header.size].abs;
+                data[header.size+1].abs = from.data[header.size+1].abs;
+            }else
+                calcAbstraction();
     }
     }
 
 public:
+    // Number of words following the literals: the activity of a learnt clause, or the two halves
+    // of the 64-bit abstraction of a problem clause.
+    static int extraWords(bool has_extra, bool learnt){ return has_extra ? (learnt ? 1 : 2) : 0; }
+
     void calcAbstraction() {
-        assert(header.has_extra);
-        uint32_t abstraction = 0;
+        assert(header.has_extra && !header.learnt);
+        uint64_t abstraction = 0;
         for (int i = 0; i < size(); i++)
-            abstraction |= 1 << (var(data[i].lit) & 31);
-        data[header.size].abs = abstraction;  }
+            abstraction |= (uint64_t)1 << (var(data[i].lit) & 63);
+        data[header.size].abs   = (uint32_t)abstraction;
+        data[header.size+1].abs = (uint32_t)(abstraction >> 32); }
 
 
     int          size        ()      const   { return header.size; }
-    void         shrink      (int i)         { assert(i <= size()); if (header.has_extra) data[header.size-i] = data[header.size]; header.size -= i; }
+    void         shrink      (int i)         { assert(i <= size());
+                                               for (int k = 0; k < extraWords(header.has_extra, header.learnt); k++)
+                                                   data[header.size-i+k] = data[header.size+k];
+                                               header.size -= i; }
     void         pop         ()              { shrink(1); }
     bool         learnt      ()      const   { return header.learnt; }
+    bool         external    ()      const   { return header.external; }
+    void         external    (bool b)        { header.external = b; }
     bool         has_extra   ()      const   { return header.has_extra; }
     uint32_t     mark        ()      const   { return header.mark; }
     void         mark        (uint32_t m)    { header.mark = m; }
@@ -211,7 +226,8 @@ public:
     operator const Lit* (void) const         { return (Lit*)data; }
 
     float&       activity    ()              { assert(header.has_extra); return data[header.size].act; }
-    uint32_t     abstraction () const        { assert(header.has_extra); return data[header.size].abs; }
+    uint64_t     abstraction () const        { assert(header.has_extra && !header.learnt);
+                                               return ((uint64_t)data[header.size+1].abs << 32) | data[header.size].abs; }
 
     Lit          subsumes    (const Clause& other) const;
     void         strengthen  (Lit p);
@@ -222,12 +238,13 @@ public:
 // ClauseAllocator -- a simple class for allocating memory for clauses:
 
 const CRef CRef_Undef = RegionAllocator<uint32_t>::Ref_Undef;
+const CRef CRef_Lazy  = RegionAllocator<uint32_t>::Ref_Undef - 1; // Reason of a literal implied by a propagator.
 class ClauseAllocator
 {
     RegionAllocator<uint32_t> ra;
 
-    static uint32_t clauseWord32Size(int size, bool has_extra){
-        return (sizeof(Clause) + (sizeof(Lit) * (size + (int)has_extra))) / sizeof(uint32_t); }
+    static uint32_t clauseWord32Size(int size, bool has_extra, bool learnt){
+        return (sizeof(Clause) + (sizeof(Lit) * (size + Clause::extraWords(has_extra, learnt)))) / sizeof(uint32_t); }
 
  public:
     enum { Unit_Size = RegionAllocator<uint32_t>::Unit_Size };
@@ -246,7 +263,7 @@ class ClauseAllocator
         assert(sizeof(Lit)      == sizeof(uint32_t));
         assert(sizeof(float)    == sizeof(uint32_t));
         bool use_extra = learnt | extra_clause_field;
-        CRef cid       = ra.alloc(clauseWord32Size(ps.size(), use_extra));
+        CRef cid       = ra.alloc(clauseWord32Size(ps.size(), use_extra, learnt));
         new (lea(cid)) Clause(ps, use_extra, learnt);
 
         return cid;
@@ -255,7 +272,7 @@ class ClauseAllocator
     CRef alloc(const Clause& from)
     {
         bool use_extra = from.learnt() | extra_clause_field;
-        CRef cid       = ra.alloc(clauseWord32Size(from.size(), use_extra));
+        CRef cid       = ra.alloc(clauseWord32Size(from.size(), use_extra, from.learnt()));
         new (lea(cid)) Clause(from, use_extra);
         return cid; }
 
@@ -272,7 +289,7 @@ class ClauseAllocator
     void free(CRef cid)
     {
         Clause& c = operator[](cid);
-        ra.free(clauseWord32Size(c.size(), c.has_extra()));
+        ra.free(clauseWord32Size(c.size(), c.has_extra(), c.learnt()));
     }
 
     void reloc(CRef& cr, ClauseAllocator& to)
@@ -440,7 +457,7 @@ inline Lit Clause::subsumes(const Clause& other) const
     //if (other.size() < size() || (!learnt() && !other.learnt() && (extra.abst & ~other.extra.abst) != 0))
     assert(!header.learnt);   assert(!other.header.learnt);
     assert(header.has_extra); assert(other.header.has_extra);
-    if (other.header.size < header.size || (data[header.size].abs & ~other.data[other.header.size].abs) != 0)
+    if (other.header.size < header.size || (abstraction() & ~other.abstraction()) != 0)
         return lit_Error;
 
     Lit        ret = lit_Undef;
@@ -20,6 +20,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "minisat/mtl/Sort.h"
 #include "minisat/simp/SimpSolver.h"
+#include "minisat/simp/Symmetry.h"
 #include "minisat/utils/System.h"
 
 using namespace Minisat;
@@ -33,6 +34,25 @@ static const char* _cat = "SIMP";
 static BoolOption   opt_use_asymm        (_cat, "asymm",        "Shrink clauses by asymmetric branching.", false);
 static BoolOption   opt_use_rcheck       (_cat, "rcheck",       "Check if a clause is already implied. (costly)", false);
 static BoolOption   opt_use_elim         (_cat, "elim",         "Perform variable elimination.", true);
+static BoolOption   opt_use_gates        (_cat, "gates",        "Detect AND/OR/XOR/ITE gate definitions to skip resolvents in variable elimination.", true);
+static BoolOption   opt_use_probing      (_cat, "probe",        "Probe roots of the binary implication graph for failed literals and hyper-binary resolvents.", false);
+static IntOption    opt_probe_lim        (_cat, "probe-lim",    "Effort limit for probing in ticks (watcher and clause visits).", 20000000, IntRange(0, INT32_MAX));
+static BoolOption   opt_use_bce          (_cat, "bce",          "Perform blocked clause elimination.", false);
+static IntOption    opt_bce_lim          (_cat, "bce-lim",      "Effort limit for blocked clause elimination in ticks (literal visits).", 20000000, IntRange(0, INT32_MAX));
+static BoolOption   opt_use_bva          (_cat, "bva",          "Perform bounded variable addition (the added variables get the lowest branching priority).", false);
+static IntOption    opt_bva_lim          (_cat, "bva-lim",      "Effort limit for bounded variable addition in ticks (literal visits).", 50000000, IntRange(0, INT32_MAX));
+static IntOption    opt_inprocess_confl  (_cat, "inprocess",    "Simplify between restarts every this many conflicts (growing arithmetically, 0 = never).", 0, IntRange(0, INT32_MAX));
+static DoubleOption opt_inprocess_effort (_cat, "inprocess-effort", "Effort of each inprocessing round relative to the search ticks since the last one.", 0.1, DoubleRange(0, false, HUGE_VAL, false));
+static BoolOption   opt_use_gauss        (_cat, "gauss",        "Replace XOR constraints encoded as clauses by Gauss-Jordan elimination.", false);
+static IntOption    opt_xor_size         (_cat, "xor-size",     "Largest XOR constraint to detect (it takes 2^(size-1) clauses).", 6, IntRange(3, 16));
+static BoolOption   opt_use_sym          (_cat, "sym",          "Add lex-leader clauses breaking symmetries of the clauses when simplification is turned off (no clauses, nor assumptions on unfrozen variables, may be added later).", false);
+static IntOption    opt_sym_gens         (_cat, "sym-gens",     "Maximum number of symmetry generators to break.", 64, IntRange(1, INT32_MAX));
+static IntOption    opt_sym_size         (_cat, "sym-size",     "Maximum number of variables compared by the lex-leader constraint of a generator.", 50, IntRange(1, INT32_MAX));
+static IntOption    opt_sym_lim          (_cat, "sym-lim",      "Effort limit for symmetry detection in ticks (vertex and edge visits).", 20000000, IntRange(0, INT32_MAX));
+static BoolOption   opt_use_amo          (_cat, "amo",          "Replace cliques of binary clauses by native at-most-one constraints.", false);
+static IntOption    opt_amo_min          (_cat, "amo-min",      "Smallest clique to replace by an at-most-one constraint.", 4, IntRange(3, INT32_MAX));
+static IntOption    opt_amo_lim          (_cat, "amo-lim",      "Effort limit for clique detection in ticks (literal visits).", 20000000, IntRange(0, INT32_MAX));
+static BoolOption   opt_use_els          (_cat, "els",          "Substitute equivalent literals found as cycles of binary implications.", true);
 static IntOption    opt_grow             (_cat, "grow",         "Allow a variable elimination step to grow by a number of clauses.", 0);
 static IntOption    opt_clause_lim       (_cat, "cl-lim",       "Variables are not eliminated if it produces a resolvent with a length above this limit. -1 means no limit", 20,   IntRange(-1, INT32_MAX));
 static IntOption    opt_subsumption_lim  (_cat, "sub-lim",      "Do not check if subsumption against a clause larger than this. -1 means no limit.", 1000, IntRange(-1, INT32_MAX));
@@ -51,26 +71,54 @@ SimpSolver::SimpSolver() :
   , use_asymm          (opt_use_asymm)
   , use_rcheck         (opt_use_rcheck)
   , use_elim           (opt_use_elim)
+  , use_els            (opt_use_els)
+  , use_gates          (opt_use_gates)
+  , use_probing        (opt_use_probing)
+  , probe_lim          (opt_probe_lim)
+  , use_bce            (opt_use_bce)
+  , bce_lim            (opt_bce_lim)
+  , use_bva            (opt_use_bva)
+  , bva_lim            (opt_bva_lim)
+  , use_gauss          (opt_use_gauss)
+  , xor_size           (opt_xor_size)
+  , use_sym            (opt_use_sym)
+  , sym_gens           (opt_sym_gens)
+  , sym_size           (opt_sym_size)
+  , sym_lim            (opt_sym_lim)
+  , use_amo            (opt_use_amo)
+  , amo_min            (opt_amo_min)
+  , amo_lim            (opt_amo_lim)
   , extend_model       (true)
   , merges             (0)
   , asymm_lits         (0)
   , eliminated_vars    (0)
+  , substituted_vars   (0)
+  , gate_elims         (0)
+  , xors               (0)
+  , sym_generators     (0)
+  , amo_cliques        (0)
   , elimorder          (1)
   , use_simplification (true)
   , occurs             (ClauseDeleted(ca))
   , elim_heap          (ElimLt(n_occ))
   , bwdsub_assigns     (0)
   , n_touched          (0)
+  , inprocessing       (false)
+  , simp_tick_limit    (UINT64_MAX)
 {
     vec<Lit> dummy(1,lit_Undef);
     ca.extra_clause_field = true; // NOTE: must happen before allocating the dummy clause below.
     bwdsub_tmpunit        = ca.alloc(dummy);
     remove_satisfied      = false;
+    inprocess_confl       = opt_inprocess_confl;
+    inprocess_effort      = opt_inprocess_effort;
 }
 
 
 SimpSolver::~SimpSolver()
 {
+    for (int i = 0; i < matrices.size(); i++)
+        delete matrices[i];
 }
 
 
@@ -97,9 +145,11 @@ void SimpSolver::releaseVar(Lit l)
         // Note: Guarantees that no references to this variable is
         // left in model extension datastructure. Could be improved!
         Solver::releaseVar(l);
-    else
+    else{
         // Otherwise, don't allow variable to be reused.
-        Solver::addClause(l);
+        add_tmp.clear();
+        add_tmp.push(l);
+        addClause_(add_tmp); }
 }
 
 
@@ -185,6 +235,87 @@ bool SimpSolver::addClause_(vec<Lit>& ps)
 }
 
 
+bool SimpSolver::addAtMost(const vec<Lit>& ps, int k)
+{
+    for (int i = 0; i < ps.size(); i++){
+        assert(!isEliminated(var(ps[i])));
+        setFrozen(var(ps[i]), true); }
+    return Solver::addAtMost(ps, k);
+}
+
+
+bool SimpSolver::addAtLeast(const vec<Lit>& ps, int k)
+{
+    for (int i = 0; i < ps.size(); i++){
+        assert(!isEliminated(var(ps[i])));
+        setFrozen(var(ps[i]), true); }
+    return Solver::addAtLeast(ps, k);
+}
+
+
+bool SimpSolver::addPb(const vec<Lit>& ps, const vec<int64_t>& cs, int64_t bound)
+{
+    for (int i = 0; i < ps.size(); i++){
+        assert(!isEliminated(var(ps[i])));
+        setFrozen(var(ps[i]), true); }
+    return Solver::addPb(ps, cs, bound);
+}
+
+
+bool SimpSolver::addCanonicity(int n, const vec<Lit>& edges)
+{
+    for (int i = 0; i < edges.size(); i++)
+        if (i / n != i % n){
+            assert(!isEliminated(var(edges[i])));
+            setFrozen(var(edges[i]), true); }
+    return Solver::addCanonicity(n, edges);
+}
+
+
+bool SimpSolver::addConnectivity(int n, const vec<Lit>& edges)
+{
+    for (int i = 0; i < edges.size(); i++)
+        if (edges[i] != lit_Undef){
+            assert(!isEliminated(var(edges[i])));
+            setFrozen(var(edges[i]), true); }
+    return Solver::addConnectivity(n, edges);
+}
+
+
+bool SimpSolver::addAcyclicity(int n, const vec<Lit>& arcs)
+{
+    for (int i = 0; i < arcs.size(); i++)
+        if (arcs[i] != lit_Undef){
+            assert(!isEliminated(var(arcs[i])));
+            setFrozen(var(arcs[i]), true); }
+    return Solver::addAcyclicity(n, arcs);
+}
+
+
+CRef SimpSolver::addExternalClause(const vec<Lit>& ps)
+{
+    for (int i = 0; i < ps.size(); i++){
+        assert(!isEliminated(var(ps[i])));
+        setFrozen(var(ps[i]), true); }
+    return Solver::addExternalClause(ps);
+}
+
+
+int SimpSolver::addRemovableClause(const vec<Lit>& ps)
+{
+    int h = Solver::addRemovableClause(ps);
+    setFrozen(removable_act[h], true);
+    return h;
+}
+
+
+void SimpSolver::push()
+{
+    Solver::push();
+    setFrozen(scope_act.last(), true);
+}
+
+
 void SimpSolver::removeClause(CRef cr)
 {
     const Clause& c = ca[cr];
@@ -269,7 +400,8 @@ bool SimpSolver::merge(const Clause& _ps, const Clause& _qs, Var v, int& size)
     const Lit*  __ps  = (const Lit*)ps;
     const Lit*  __qs  = (const Lit*)qs;
 
-    size = ps.size()-1;
+    size   = ps.size()-1;
+    ticks += ps.size() + qs.size();
 
     for (int i = 0; i < qs.size(); i++){
         if (var(__qs[i]) != v){
@@ -341,6 +473,7 @@ bool SimpSolver::implied(const vec<Lit>& c)
 bool SimpSolver::backwardSubsumptionCheck(bool verbose)
 {
     int cnt = 0;
+    int polls = 0;
     int subsumed = 0;
     int deleted_literals = 0;
     assert(decisionLevel() == 0);
@@ -353,6 +486,10 @@ bool SimpSolver::backwardSubsumptionCheck(bool verbose)
             bwdsub_assigns = trail.size();
             break; }
 
+        // Leave the rest of the queue once the deadline has passed ('eliminate()' stops as well):
+        if ((++polls & 1023) == 0 && deadlinePassed())
+            break;
+
         // Check top-level assignments by creating a dummy clause and placing it in the queue:
         if (subsumption_queue.size() == 0 && bwdsub_assigns < trail.size()){
             Lit l = trail[bwdsub_assigns++];
@@ -379,26 +516,55 @@ bool SimpSolver::backwardSubsumptionCheck(bool verbose)
         // Search all candidates:
         vec<CRef>& _cs = occurs.lookup(best);
         CRef*       cs = (CRef*)_cs;
-
-        for (int j = 0; j < _cs.size(); j++)
-            if (c.mark())
-                break;
-            else if (!ca[cs[j]].mark() &&  cs[j] != cr && (subsumption_lim == -1 || ca[cs[j]].size() < subsumption_lim)){
-                Lit l = c.subsumes(ca[cs[j]]);
-
-                if (l == lit_Undef)
-                    subsumed++, removeClause(cs[j]);
-                else if (l != lit_Error){
-                    deleted_literals++;
-
-                    if (!strengthenClause(cs[j], ~l))
-                        return false;
-
-                    // Did current candidate get deleted from cs? Then check candidate at index j again:
-                    if (var(l) == best)
-                        j--;
-                }
+        ticks += _cs.size();
+
+        // Mark the literals of 'c' ('seen' is 1 for positive, 2 for negative literals), so that each
+        // candidate passing the size and abstraction filter is checked in one pass over its literals:
+        uint64_t abs  = c.abstraction();
+        int      size = c.size();
+        for (int i = 0; i < size; i++)
+            seen[var(c[i])] = 1 + sign(c[i]);
+
+        // (Strengthening propagates, and propagators may allocate clauses: 'c' is looked up again.)
+        bool no_confl = true;
+        for (int j = 0; j < _cs.size() && !ca[cr].mark(); j++){
+            const Clause& d = ca[cs[j]];
+            if (d.mark() || cs[j] == cr || d.size() < size || (abs & ~d.abstraction()) != 0
+                || (subsumption_lim != -1 && d.size() >= subsumption_lim))
+                continue;
+
+            // Count the literals of 'c' occurring in 'd', allowing for one with the opposite sign:
+            Lit l     = lit_Undef;
+            int found = 0;
+            for (int k = 0; k < d.size() && d.size() - k >= size - found; k++)
+                if (seen[var(d[k])] == 1 + sign(d[k]))
+                    found++;
+                else if (seen[var(d[k])] != 0){
+                    if (l != lit_Undef){ l = lit_Error; break; }
+                    l = ~d[k];
+                    found++; }
+            if (l == lit_Error || found < size)
+                continue;
+
+            if (l == lit_Undef)
+                subsumed++, removeClause(cs[j]);
+            else{
+                deleted_literals++;
+
+                if (!strengthenClause(cs[j], ~l)){
+                    no_confl = false;
+                    break; }
+
+                // Did current candidate get deleted from cs? Then check candidate at index j again:
+                if (var(l) == best)
+                    j--;
             }
+        }
+
+        for (int i = 0; i < size; i++)
+            seen[var(ca[cr][i])] = 0;
+        if (!no_confl)
+            return false;
     }
 
     return true;
@@ -482,6 +648,114 @@ static void mkElimClause(vec<uint32_t>& elimclauses, Var v, Clause& c)
 
 
 
+// Returns the index of a ternary clause in 'cs' consisting of the literals 'a', 'b' and 'c', or -1.
+static int findTernary(const ClauseAllocator& ca, const vec<CRef>& cs, Lit a, Lit b, Lit c)
+{
+    for (int i = 0; i < cs.size(); i++){
+        const Clause& d = ca[cs[i]];
+        if (d.size() == 3 && find(d, a) && find(d, b) && find(d, c))
+            return i;
+    }
+    return -1;
+}
+
+
+// Look for clauses defining 'v' as an AND/OR, XOR or ITE gate of other variables. The clauses of the
+// gate are flagged in 'pos_gate'/'neg_gate' (parallel to 'pos'/'neg'). When 'v' is defined, the
+// resolvents between two gate clauses are tautologies and those between two non-gate clauses are
+// implied by the others, so only gate/non-gate resolvents are needed to eliminate 'v'.
+bool SimpSolver::findGate(Var v, const vec<CRef>& pos, const vec<CRef>& neg, vec<char>& pos_gate, vec<char>& neg_gate)
+{
+    // AND gate 'x = a1 & ... & an' (OR gates are AND gates on '~v'): the binary clauses '(~x v ai)'
+    // together with the clause '(x v ~a1 v ... v ~an)':
+    for (int s = 0; s < 2; s++){
+        Lit              x  = mkLit(v, s == 1);
+        const vec<CRef>& xs = s == 0 ? pos : neg;
+        const vec<CRef>& ys = s == 0 ? neg : pos;
+        vec<char>&       xg = s == 0 ? pos_gate : neg_gate;
+        vec<char>&       yg = s == 0 ? neg_gate : pos_gate;
+
+        // Mark the literals implied by 'x' ('seen' is 1 for positive, 2 for negative literals):
+        int nbins = 0;
+        for (int i = 0; i < ys.size(); i++){
+            const Clause& c = ca[ys[i]];
+            if (c.size() == 2){
+                Lit a = c[0] == ~x ? c[1] : c[0];
+                seen[var(a)] = 1 + sign(a);
+                nbins++; } }
+
+        int found = -1;
+        for (int i = 0; i < xs.size() && found == -1 && nbins > 0; i++){
+            const Clause& c = ca[xs[i]];
+            if (c.size() < 2 || c.size() > nbins + 1) continue;
+            bool all = true;
+            for (int j = 0; j < c.size() && all; j++)
+                all = c[j] == x || seen[var(c[j])] == 2 - sign(c[j]);
+            if (all) found = i;
+        }
+
+        for (int i = 0; i < ys.size(); i++){
+            const Clause& c = ca[ys[i]];
+            if (c.size() == 2){
+                Lit a = c[0] == ~x ? c[1] : c[0];
+                seen[var(a)] = 0;
+                if (found != -1 && find(ca[xs[found]], ~a))
+                    yg[i] = 1;
+            } }
+
+        if (found != -1){
+            xg[found] = 1;
+            return true; }
+    }
+
+    // Gates over ternary clauses are searched with quadratic effort, so only for few occurrences:
+    const int max_occs = 64;
+    if (pos.size() + neg.size() > max_occs)
+        return false;
+
+    Lit x = mkLit(v);
+    for (int i = 0; i < pos.size(); i++){
+        const Clause& c = ca[pos[i]];
+        if (c.size() != 3) continue;
+
+        Lit p = lit_Undef, q = lit_Undef;
+        for (int k = 0; k < 3; k++)
+            if (var(c[k]) != v) (p == lit_Undef ? p : q) = c[k];
+
+        // XOR gate 'v = p ^ q ^ 1': '(v v p v q)', '(v v ~p v ~q)', '(~v v ~p v q)', '(~v v p v ~q)':
+        int a = findTernary(ca, pos,  x, ~p, ~q);
+        int b = findTernary(ca, neg, ~x, ~p,  q);
+        int d = findTernary(ca, neg, ~x,  p, ~q);
+        if (a != -1 && b != -1 && d != -1){
+            pos_gate[i] = pos_gate[a] = neg_gate[b] = neg_gate[d] = 1;
+            return true; }
+
+        // ITE gate: '(v v y v c)', '(v v z v ~c)', '(~v v ~y v c)', '(~v v ~z v ~c)', with 'c' being
+        // either of the two other literals of the first clause:
+        for (int k = 0; k < 2; k++){
+            Lit cond = k == 0 ? p : q;
+            Lit y    = k == 0 ? q : p;
+            for (int j = 0; j < pos.size(); j++){
+                const Clause& e = ca[pos[j]];
+                if (j == i || e.size() != 3 || !find(e, ~cond)) continue;
+
+                Lit z = lit_Undef;
+                for (int m = 0; m < 3; m++)
+                    if (var(e[m]) != v && e[m] != ~cond) z = e[m];
+
+                int b = findTernary(ca, neg, ~x, ~y,  cond);
+                int d = findTernary(ca, neg, ~x, ~z, ~cond);
+                if (b != -1 && d != -1){
+                    pos_gate[i] = pos_gate[j] = neg_gate[b] = neg_gate[d] = 1;
+                    return true; }
+            }
+        }
+    }
+
+    return false;
+}
+
+
 bool SimpSolver::eliminateVar(Var v)
 {
     assert(!frozen[v]);
@@ -495,6 +769,12 @@ bool SimpSolver::eliminateVar(Var v)
     for (int i = 0; i < cls.size(); i++)
         (find(ca[cls[i]], mkLit(v)) ? pos : neg).push(cls[i]);
 
+    // If 'v' is defined by a gate, resolvents between two gate or two non-gate clauses are redundant:
+    //
+    vec<char> pos_gate(pos.size(), 0);
+    vec<char> neg_gate(neg.size(), 0);
+    bool      gate = use_gates && findGate(v, pos, neg, pos_gate, neg_gate);
+
     // Check wether the increase in number of clauses stays within the allowed ('grow'). Moreover, no
     // clause must exceed the limit on the maximal clause size (if it is set):
     //
@@ -503,7 +783,8 @@ bool SimpSolver::eliminateVar(Var v)
 
     for (int i = 0; i < pos.size(); i++)
         for (int j = 0; j < neg.size(); j++)
-            if (merge(ca[pos[i]], ca[neg[j]], v, clause_size) && 
+            if ((!gate || pos_gate[i] != neg_gate[j]) &&
+                merge(ca[pos[i]], ca[neg[j]], v, clause_size) && 
                 (++cnt > cls.size() + grow || (clause_lim != -1 && clause_size > clause_lim)))
                 return true;
 
@@ -511,6 +792,7 @@ bool SimpSolver::eliminateVar(Var v)
     eliminated[v] = true;
     setDecisionVar(v, false);
     eliminated_vars++;
+    if (gate) gate_elims++;
 
     if (pos.size() > neg.size()){
         for (int i = 0; i < neg.size(); i++)
@@ -529,7 +811,8 @@ bool SimpSolver::eliminateVar(Var v)
     vec<Lit>& resolvent = add_tmp;
     for (int i = 0; i < pos.size(); i++)
         for (int j = 0; j < neg.size(); j++)
-            if (merge(ca[pos[i]], ca[neg[j]], v, resolvent) && !addClause_(resolvent))
+            if ((!gate || pos_gate[i] != neg_gate[j]) &&
+                merge(ca[pos[i]], ca[neg[j]], v, resolvent) && !addClause_(resolvent))
                 return false;
 
     // Free occurs list for this variable:
@@ -553,6 +836,16 @@ bool SimpSolver::substitute(Var v, Lit x)
 
     eliminated[v] = true;
     setDecisionVar(v, false);
+    substituted_vars++;
+
+    // Store the equivalence 'v <-> x' for model extension (with the 'v' literal first):
+    elimclauses.push(toInt(mkLit(v)));
+    elimclauses.push(toInt(~x));
+    elimclauses.push(2);
+    elimclauses.push(toInt(~mkLit(v)));
+    elimclauses.push(toInt(x));
+    elimclauses.push(2);
+
     const vec<CRef>& cls = occurs.lookup(v);
     
     vec<Lit>& subst_clause = add_tmp;
@@ -575,6 +868,890 @@ bool SimpSolver::substitute(Var v, Lit x)
 }
 
 
+// Find the strongly connected components of the binary implication graph (Tarjan's algorithm),
+// and replace all variables of each component by a single representative literal. A component
+// containing both a literal and its negation proves the formula unsatisfiable.
+bool SimpSolver::substituteEquivalences()
+{
+    assert(decisionLevel() == 0);
+    assert(use_simplification);
+
+    // Build the implication graph of the binary problem clauses over unassigned variables, stored
+    // as adjacency arrays: the successors of literal 'p' are 'edges[start[toInt(p)] .. start[toInt(p)+1]-1]'.
+    int       n = 2*nVars();
+    vec<int>  start(n+1, 0);
+    vec<Lit>  edges;
+    for (int i = 0; i < clauses.size(); i++){
+        const Clause& c = ca[clauses[i]];
+        if (c.mark() == 0 && c.size() == 2 && value(c[0]) == l_Undef && value(c[1]) == l_Undef){
+            start[toInt(~c[0])]++;
+            start[toInt(~c[1])]++; } }
+
+    for (int i = 1; i <= n; i++) start[i] += start[i-1];
+    edges.growTo(start[n]);
+    for (int i = 0; i < clauses.size(); i++){
+        const Clause& c = ca[clauses[i]];
+        if (c.mark() == 0 && c.size() == 2 && value(c[0]) == l_Undef && value(c[1]) == l_Undef){
+            edges[--start[toInt(~c[0])]] = c[1];
+            edges[--start[toInt(~c[1])]] = c[0]; } }
+    if (edges.size() == 0) return true;
+
+    // Iterative version of Tarjan's algorithm. 'rep[p]' is the representative literal chosen for 'p'
+    // (lit_Undef for literals whose component is trivial or not yet processed):
+    vec<int>  index(n, -1), low(n, 0), pos(n, 0);
+    vec<char> on_stack(n, 0);
+    vec<Lit>  stack, dfs, scc;
+    vec<Lit>  rep(n, lit_Undef);
+    int       counter = 0;
+
+    for (int root = 0; root < n; root++){
+        if (index[root] != -1 || start[root] == start[root+1]) continue;
+
+        dfs.push(toLit(root));
+        index[root] = low[root] = counter++;
+        pos[root]   = start[root];
+        stack.push(toLit(root)); on_stack[root] = 1;
+
+        while (dfs.size() > 0){
+            int p = toInt(dfs.last());
+            if (pos[p] < start[p+1]){
+                int q = toInt(edges[pos[p]++]);
+                if (index[q] == -1){
+                    index[q] = low[q] = counter++;
+                    pos[q]   = start[q];
+                    stack.push(toLit(q)); on_stack[q] = 1;
+                    dfs.push(toLit(q));
+                }else if (on_stack[q] && index[q] < low[p])
+                    low[p] = index[q];
+                continue; }
+
+            dfs.pop();
+            if (dfs.size() > 0 && low[p] < low[toInt(dfs.last())])
+                low[toInt(dfs.last())] = low[p];
+            if (low[p] != index[p]) continue;
+
+            // 'p' is the root of a component; pop it from the stack:
+            scc.clear();
+            Lit q;
+            do{
+                q = stack.last(); stack.pop();
+                on_stack[toInt(q)] = 0;
+                scc.push(q);
+            }while (toInt(q) != p);
+
+            // Components come in dual pairs; only the first one of each pair is processed:
+            if (scc.size() == 1 || rep[toInt(scc[0])] != lit_Undef) continue;
+
+            // Pick a frozen variable as representative if there is one (frozen variables must not be
+            // substituted), otherwise the smallest one:
+            Lit r = scc[0];
+            for (int i = 1; i < scc.size(); i++)
+                if (frozen[var(scc[i])] > frozen[var(r)] || (frozen[var(scc[i])] == frozen[var(r)] && var(scc[i]) < var(r)))
+                    r = scc[i];
+
+            for (int i = 0; i < scc.size(); i++){
+                if (rep[toInt(~scc[i])] != lit_Undef)
+                    // Both 'scc[i]' and '~scc[i]' are in this component:
+                    return ok = false;
+                rep[toInt( scc[i])] =  r;
+                rep[toInt(~scc[i])] = ~r;
+            }
+        }
+    }
+
+    // Substitute every variable by its representative:
+    int substituted = substituted_vars;
+    for (Var v = 0; v < nVars(); v++){
+        Lit r = rep[toInt(mkLit(v))];
+        if (r == lit_Undef || var(r) == v || frozen[v] || isEliminated(v)) continue;
+
+        // Earlier substitutions may have produced units; those propagate through the equivalences:
+        if (value(v) != l_Undef || value(r) != l_Undef) continue;
+
+        if (!substitute(v, r))
+            return false;
+    }
+
+    if (verbosity >= 2 && substituted_vars > substituted)
+        printf("|  Substituted equivalent variables: %8d                                 |\n",
+               substituted_vars - substituted);
+
+    return true;
+}
+
+
+// Find XOR constraints encoded as the 2^(k-1) clauses over the same k variables that exclude the
+// assignments of the wrong parity. These clauses are removed, and the XOR constraints propagated
+// by Gauss-Jordan elimination instead, with one matrix per group of XORs connected by shared
+// variables. The variables of the matrices are frozen.
+bool SimpSolver::detectXors()
+{
+    assert(decisionLevel() == 0);
+
+    vec<Var>  xs;               // Variables of all XORs found,
+    vec<int>  xor_start;        // start index of each XOR in 'xs',
+    vec<char> xor_rhs;          // and its right-hand side.
+    vec<Var>  vs;
+    vec<char> patterns;
+    int       removed = 0;
+
+    for (int i = 0; i < clauses.size(); i++){
+        const Clause& c = ca[clauses[i]];
+        if (c.mark() || c.size() < 3 || c.size() > xor_size) continue;
+
+        bool assigned = false;
+        bool par      = false;
+        vs.clear();
+        for (int j = 0; j < c.size(); j++){
+            assigned |= value(c[j]) != l_Undef;
+            par      ^= sign(c[j]);
+            vs.push(var(c[j])); }
+        if (assigned) continue;
+        sort(vs);
+
+        // Collect the sign patterns of the clauses over the same variables with the same parity:
+        Var best = vs[0];
+        for (int j = 1; j < vs.size(); j++)
+            if (occurs[vs[j]].size() < occurs[best].size())
+                best = vs[j];
+        uint64_t         abs  = c.abstraction();
+        int              need = 1 << (vs.size() - 1);
+        int              got  = 0;
+        const vec<CRef>& cs   = occurs.lookup(best);
+        ticks += cs.size();
+        patterns.clear();
+        patterns.growTo(1 << vs.size(), 0);
+        for (int j = 0; j < cs.size(); j++){
+            const Clause& d = ca[cs[j]];
+            if (d.mark() || d.size() != vs.size() || d.abstraction() != abs) continue;
+
+            int  pattern = 0;
+            bool p       = false;
+            int  k       = 0;
+            for (; k < d.size(); k++){
+                int pos = 0;
+                while (pos < vs.size() && vs[pos] != var(d[k])) pos++;
+                if (pos == vs.size()) break;
+                pattern |= (int)sign(d[k]) << pos;
+                p       ^= sign(d[k]); }
+            if (k < d.size() || p != par || patterns[pattern]) continue;
+            patterns[pattern] = 1;
+            got++;
+        }
+        if (got < need) continue;
+
+        // A clause excludes the assignment making all its literals false, which has the parity of
+        // its signs. So the XOR of the variables is the opposite:
+        xor_start.push(xs.size());
+        for (int j = 0; j < vs.size(); j++)
+            xs.push(vs[j]);
+        xor_rhs.push(!par);
+
+        for (int j = 0; j < cs.size(); j++){
+            const Clause& d = ca[cs[j]];
+            if (!d.mark() && d.size() == vs.size() && d.abstraction() == abs){
+                int  k = 0;
+                bool p = false;
+                for (; k < d.size() && find(vs, var(d[k])); k++)
+                    p ^= sign(d[k]);
+                if (k == d.size() && p == par){
+                    removeClause(cs[j]);
+                    removed++; }
+            }
+        }
+    }
+    xor_start.push(xs.size());
+    int n_xors = xor_rhs.size();
+    if (n_xors == 0) return true;
+
+    // Group the XORs by shared variables (union-find over the XORs):
+    vec<int> parent(n_xors);
+    vec<int> owner(nVars(), -1);
+    for (int i = 0; i < n_xors; i++){
+        parent[i] = i;
+        for (int j = xor_start[i]; j < xor_start[i+1]; j++){
+            Var v = xs[j];
+            if (owner[v] == -1){
+                owner[v] = i;
+                continue; }
+            int a = owner[v], b = i;
+            while (parent[a] != a) a = parent[a] = parent[parent[a]];
+            while (parent[b] != b) b = parent[b] = parent[parent[b]];
+            parent[b] = a;
+        }
+    }
+
+    vec<int> matrix_of(n_xors, -1);
+    int      first = matrices.size();
+    for (int i = 0; i < n_xors; i++){
+        int r = i;
+        while (parent[r] != r) r = parent[r];
+        if (matrix_of[r] == -1){
+            matrix_of[r] = matrices.size();
+            matrices.push(new GaussPropagator()); }
+
+        vs.clear();
+        for (int j = xor_start[i]; j < xor_start[i+1]; j++){
+            vs.push(xs[j]);
+            setFrozen(xs[j], true); }
+        matrices[matrix_of[r]]->addXor(vs, xor_rhs[i]);
+    }
+    for (int i = first; i < matrices.size(); i++)
+        matrices[i]->attach(*this);
+    xors += n_xors;
+
+    if (verbosity >= 1)
+        printf("|  XOR: %7d constraints, %6d matrices, %8d clauses removed        |\n",
+               n_xors, matrices.size() - first, removed);
+
+    return propagate() == CRef_Undef;
+}
+
+
+struct DegreeLt {
+    const vec<vec<Lit> >& nb;
+    explicit DegreeLt(const vec<vec<Lit> >& n) : nb(n) {}
+    bool operator()(Lit x, Lit y) const { return nb[toInt(x)].size() > nb[toInt(y)].size(); }
+};
+
+// Replace cliques of binary clauses by native at-most-one constraints. In the graph where '~a' and
+// '~b' are adjacent for every binary clause '(a v b)' (they can not both be true), a clique is grown
+// greedily from each literal in order of decreasing degree, adding its neighbours (in the same
+// order) that are adjacent to all literals so far. A clique of at least 'amo_min' literals replaces
+// its binary clauses if at least as many of them are left as it has literals. The variables of the
+// constraints are frozen; the effort is bounded by 'amo_lim' ticks.
+bool SimpSolver::detectCliques()
+{
+    assert(decisionLevel() == 0);
+
+    vec<vec<Lit> >  nb(2*nVars());
+    vec<vec<CRef> > nb_cr(2*nVars());   // The binary clause of each adjacency.
+    for (int i = 0; i < clauses.size(); i++){
+        const Clause& c = ca[clauses[i]];
+        if (c.mark() || c.size() != 2 || value(c[0]) != l_Undef || value(c[1]) != l_Undef) continue;
+        nb   [toInt(~c[0])].push(~c[1]);
+        nb_cr[toInt(~c[0])].push(clauses[i]);
+        nb   [toInt(~c[1])].push(~c[0]);
+        nb_cr[toInt(~c[1])].push(clauses[i]);
+    }
+
+    vec<Lit> seeds;
+    for (int i = 0; i < nb.size(); i++)
+        if (nb[i].size() >= amo_min - 1)
+            seeds.push(toLit(i));
+    sort(seeds, DegreeLt(nb));
+
+    vec<int>  cnt  (2*nVars(), 0);      // Number of clique literals each literal is adjacent to,
+    vec<int>  stamp(2*nVars(), 0);      // and the last one counted (binary clauses may be duplicated).
+    vec<char> in_clique(2*nVars(), 0);
+    vec<Lit>  clique, cands, touched;
+    int       members = 0;
+    int       cliques = 0;
+    int       removed = 0;
+    uint64_t  limit   = ticks + amo_lim;
+    for (int s = 0; s < seeds.size() && ticks < limit; s++){
+        nb[toInt(seeds[s])].copyTo(cands);
+        sort(cands, DegreeLt(nb));
+        clique.clear();
+        touched.clear();
+        for (int k = -1; k < cands.size(); k++){
+            Lit q = k == -1 ? seeds[s] : cands[k];
+            if (in_clique[toInt(q)] || cnt[toInt(q)] < clique.size()) continue;
+            clique.push(q);
+            in_clique[toInt(q)] = 1;
+            members++;
+            const vec<Lit>& ns = nb[toInt(q)];
+            ticks += ns.size();
+            for (int j = 0; j < ns.size(); j++){
+                int x = toInt(ns[j]);
+                if (stamp[x] == members) continue;
+                stamp[x] = members;
+                if (cnt[x]++ == 0) touched.push(ns[j]);
+            }
+        }
+
+        // Count the binary clauses left inside the clique, and remove them if it pays off:
+        int binaries = 0;
+        for (int pass = 0; pass < 2 && clique.size() >= amo_min; pass++){
+            for (int k = 0; k < clique.size(); k++){
+                const vec<Lit>&  ns  = nb   [toInt(clique[k])];
+                const vec<CRef>& crs = nb_cr[toInt(clique[k])];
+                for (int j = 0; j < ns.size(); j++)
+                    if (in_clique[toInt(ns[j])] && clique[k] < ns[j] && !ca[crs[j]].mark()){
+                        if (pass == 0) binaries++;
+                        else           removeClause(crs[j]); }
+            }
+            if (binaries < clique.size()) break;
+        }
+        if (clique.size() >= amo_min && binaries >= clique.size()){
+            if (!addAtMost(clique, 1)) return false;
+            cliques++;
+            removed += binaries; }
+
+        for (int k = 0; k < touched.size(); k++)
+            cnt[toInt(touched[k])] = 0;
+        for (int k = 0; k < clique.size(); k++)
+            in_clique[toInt(clique[k])] = 0;
+    }
+    amo_cliques += cliques;
+
+    if (verbosity >= 1 && cliques > 0)
+        printf("|  AMO: %7d constraints, %8d clauses removed                         |\n",
+               cliques, removed);
+
+    return true;
+}
+
+
+// Probe both polarities of every variable that has a root of the binary implication graph as one of
+// its literals. A polarity leading to a conflict is a failed literal, and literals implied by both
+// polarities are necessary assignments; either is added as a unit. Literals implied through longer
+// clauses give hyper-binary resolvents with the probed literal. Finally, binary clauses implied by a
+// path of other binary clauses are removed (transitive reduction). All of this is bounded by
+// 'probe_lim' ticks.
+bool SimpSolver::probe()
+{
+    assert(decisionLevel() == 0);
+    assert(use_simplification);
+
+    if (!ok || propagate() != CRef_Undef)
+        return ok = false;
+
+    uint64_t  limit  = ticks + probe_lim < simp_tick_limit ? ticks + probe_lim : simp_tick_limit;
+    int       n      = 2*nVars();
+    int       failed = 0, necessary = 0, hbrs = 0, reduced = 0;
+    vec<int>  bin_occ(n, 0);
+    vec<char> implied(n, 0);
+    vec<Lit>  found, units, hbr;
+
+    for (int i = 0; i < clauses.size(); i++){
+        const Clause& c = ca[clauses[i]];
+        if (c.mark() == 0 && c.size() == 2){
+            bin_occ[toInt(c[0])]++;
+            bin_occ[toInt(c[1])]++; } }
+
+    for (Var v = 0; v < nVars() && ticks < limit; v++){
+        if (value(v) != l_Undef || isEliminated(v)) continue;
+
+        // A literal is a root if it has no incoming binary implications (does not occur in binary
+        // clauses) but some outgoing ones:
+        Lit root;
+        if      (bin_occ[toInt( mkLit(v))] == 0 && bin_occ[toInt(~mkLit(v))] > 0) root =  mkLit(v);
+        else if (bin_occ[toInt(~mkLit(v))] == 0 && bin_occ[toInt( mkLit(v))] > 0) root = ~mkLit(v);
+        else continue;
+
+        units.clear();
+        hbr.clear();
+        found.clear();
+        for (int pol = 0; pol < 2; pol++){
+            Lit p = pol == 0 ? root : ~root;
+            newDecisionLevel();
+            uncheckedEnqueue(p);
+            if (propagate() != CRef_Undef){
+                cancelUntil(0);
+                units.clear();
+                units.push(~p);
+                failed++;
+                break; }
+
+            for (int i = trail_lim[0] + 1; i < trail.size(); i++){
+                Lit  q = trail[i];
+                CRef r = reason(var(q));
+
+                // (learnt clauses may still contain variables eliminated earlier in this round)
+                if (isEliminated(var(q))) continue;
+
+                if (pol == 0){
+                    implied[toInt(q)] = 1;
+                    found.push(q);
+                }else if (implied[toInt(q)]){
+                    units.push(q);
+                    necessary++; }
+                if (r != CRef_Undef && (r == CRef_Lazy || ca[r].size() > 2)){
+                    hbr.push(~p);
+                    hbr.push(q); }
+            }
+            cancelUntil(0);
+        }
+        for (int i = 0; i < found.size(); i++)
+            implied[toInt(found[i])] = 0;
+
+        for (int i = 0; i < units.size(); i++)
+            if (value(units[i]) == l_False)
+                return ok = false;
+            else if (value(units[i]) == l_Undef){
+                uncheckedEnqueue(units[i]);
+                if (propagate() != CRef_Undef)
+                    return ok = false; }
+
+        // Only add the resolvents if no unit was found (the units may satisfy them):
+        if (units.size() == 0)
+            for (int i = 0; i < hbr.size(); i += 2){
+                add_tmp.clear();
+                add_tmp.push(hbr[i]);
+                add_tmp.push(hbr[i+1]);
+                if (!addClause_(add_tmp))
+                    return false;
+                bin_occ[toInt(hbr[i])]++;
+                bin_occ[toInt(hbr[i+1])]++;
+                hbrs++; }
+    }
+
+    // Transitive reduction: build the binary implication graph, remembering the clause of each edge:
+    vec<int>  start(n+1, 0);
+    vec<Lit>  edges;
+    vec<CRef> edge_cr;
+    for (int i = 0; i < clauses.size(); i++){
+        const Clause& c = ca[clauses[i]];
+        if (c.mark() == 0 && c.size() == 2 && value(c[0]) == l_Undef && value(c[1]) == l_Undef){
+            start[toInt(~c[0])]++;
+            start[toInt(~c[1])]++; } }
+    for (int i = 1; i <= n; i++) start[i] += start[i-1];
+    edges  .growTo(start[n]);
+    edge_cr.growTo(start[n]);
+    for (int i = 0; i < clauses.size(); i++){
+        const Clause& c = ca[clauses[i]];
+        if (c.mark() == 0 && c.size() == 2 && value(c[0]) == l_Undef && value(c[1]) == l_Undef){
+            int k = --start[toInt(~c[0])]; edges[k] = c[1]; edge_cr[k] = clauses[i];
+            k     = --start[toInt(~c[1])]; edges[k] = c[0]; edge_cr[k] = clauses[i]; } }
+
+    // Remove '(a v b)' if 'b' can be reached from '~a' without it. Each search is limited to
+    // 'max_visit' literals. Checking one direction suffices, since the graph is symmetric:
+    const int max_visit = 1000;
+    vec<int>  stamp(n, 0);
+    vec<Lit>  queue;
+    for (int i = 0, id = 1; i < clauses.size() && ticks < limit; i++){
+        CRef          cr = clauses[i];
+        const Clause& c  = ca[cr];
+        if (c.mark() != 0 || c.size() != 2 || value(c[0]) != l_Undef || value(c[1]) != l_Undef) continue;
+
+        Lit  to    = c[1];
+        bool reach = false;
+        queue.clear();
+        queue.push(~c[0]);
+        stamp[toInt(~c[0])] = ++id;
+        for (int h = 0; h < queue.size() && queue.size() < max_visit && !reach; h++){
+            int x = toInt(queue[h]);
+            for (int k = start[x]; k < start[x+1]; k++){
+                ticks++;
+                if (edge_cr[k] == cr || ca[edge_cr[k]].mark() != 0) continue;
+                Lit y = edges[k];
+                if (y == to){
+                    reach = true;
+                    break; }
+                if (stamp[toInt(y)] != id){
+                    stamp[toInt(y)] = id;
+                    queue.push(y); }
+            }
+        }
+        if (reach){
+            removeClause(cr);
+            reduced++; }
+    }
+
+    if (verbosity >= 2)
+        printf("|  Probing: %6d failed, %6d necessary, %6d hyper-binary, %6d reduced |\n",
+               failed, necessary, hbrs, reduced);
+
+    return true;
+}
+
+
+// Remove clauses that are blocked on one of their literals 'l': every resolvent on 'l' with a clause
+// containing '~l' is a tautology. Only non-frozen variables are used as blocking literals. Removed
+// clauses are stored for model extension, with the blocking literal first. Like variable
+// elimination, this requires that variables used in clauses added later are frozen.
+bool SimpSolver::blockedClauseElim()
+{
+    assert(decisionLevel() == 0);
+    assert(use_simplification);
+
+    uint64_t limit   = ticks + bce_lim < simp_tick_limit ? ticks + bce_lim : simp_tick_limit;
+    int      blocked = 0;
+    bool     progress;
+
+    do{
+        progress = false;
+        for (int i = 0; i < clauses.size() && ticks < limit; i++){
+            CRef    cr = clauses[i];
+            Clause& c  = ca[cr];
+            if (c.mark() != 0) continue;
+
+            bool assigned = false;
+            for (int j = 0; j < c.size(); j++)
+                if (value(c[j]) != l_Undef){
+                    assigned = true;
+                    break; }
+            if (assigned) continue;
+
+            // Mark the literals of 'c' ('seen' is 1 for positive, 2 for negative literals):
+            for (int j = 0; j < c.size(); j++)
+                seen[var(c[j])] = 1 + sign(c[j]);
+
+            Lit blocking = lit_Undef;
+            for (int j = 0; j < c.size() && blocking == lit_Undef; j++){
+                Lit l = c[j];
+                if (frozen[var(l)]) continue;
+
+                const vec<CRef>& cls = occurs.lookup(var(l));
+                bool             all = true;
+                for (int k = 0; k < cls.size() && all; k++){
+                    const Clause& d     = ca[cls[k]];
+                    bool          neg   = false;
+                    bool          taut  = false;
+                    ticks += d.size();
+                    for (int m = 0; m < d.size() && !taut; m++)
+                        if (d[m] == ~l)
+                            neg = true;
+                        else if (var(d[m]) != var(l) && seen[var(d[m])] == 2 - sign(d[m]))
+                            taut = true;
+                    all = !neg || taut;
+                }
+                if (all) blocking = l;
+            }
+
+            for (int j = 0; j < c.size(); j++)
+                seen[var(c[j])] = 0;
+
+            if (blocking != lit_Undef){
+                mkElimClause(elimclauses, var(blocking), c);
+                removeClause(cr);
+                blocked++;
+                progress = true; }
+        }
+    }while (progress && ticks < limit);
+
+    if (verbosity >= 2)
+        printf("|  Blocked clauses:      %12d                                         |\n", blocked);
+
+    return true;
+}
+
+
+// Collect the (non-removed) clauses containing 'l' into 'out':
+void SimpSolver::collectOccurrences(Lit l, vec<CRef>& out)
+{
+    const vec<CRef>& cls = occurs.lookup(var(l));
+    out.clear();
+    for (int i = 0; i < cls.size(); i++)
+        if (ca[cls[i]].mark() == 0 && find(ca[cls[i]], l))
+            out.push(cls[i]);
+}
+
+
+// Returns a clause 'D' equal to 'c' with the literal 'l' replaced by 'lit', or CRef_Undef. The literals
+// of 'c' must be marked in 'seen' (1 for positive, 2 for negative literals).
+CRef SimpSolver::findReplaced(const Clause& c, Lit l, Lit lit)
+{
+    const vec<CRef>& cls = occurs.lookup(var(lit));
+    for (int i = 0; i < cls.size(); i++){
+        const Clause& d = ca[cls[i]];
+        if (d.mark() != 0 || d.size() != c.size()) continue;
+        ticks += d.size();
+
+        int j = 0;
+        for (; j < d.size(); j++)
+            if (d[j] != lit && (d[j] == l || seen[var(d[j])] != 1 + sign(d[j])))
+                break;
+        if (j == d.size() && find(d, lit))
+            return cls[i];
+    }
+    return CRef_Undef;
+}
+
+
+struct BvaLt {
+    const LMap<int>& n_occ;
+    explicit BvaLt(const LMap<int>& no) : n_occ(no) {}
+    bool operator()(Lit x, Lit y) const { return n_occ[x] > n_occ[y]; }
+};
+
+// Number of clauses saved by replacing the 'lits' x 'cls' clauses '(li v Cj)' by the clauses
+// '(li v ~x)' and '(Cj v x)' for a fresh variable 'x':
+static inline int bvaReduction(int lits, int cls) { return lits * cls - lits - cls; }
+
+// Bounded variable addition (Manthey, Heule, Biere: "Automated Reencoding of Boolean Formulas"):
+// look for sets of literals 'L' and clauses 'C' such that all clauses '(l v c)' for 'l' in 'L' and
+// 'c' in 'C' are present, and replace them by fewer clauses using a new variable. Literals are
+// processed in order of decreasing number of occurrences; the effort is bounded by 'bva_lim' ticks.
+bool SimpSolver::boundedVariableAddition()
+{
+    assert(decisionLevel() == 0);
+    assert(use_simplification);
+
+    uint64_t  limit     = ticks + bva_lim;
+    int       vars0     = nVars();
+    int       clauses0  = nClauses();
+    Heap<Lit,BvaLt,MkIndexLit> queue((BvaLt(n_occ)));
+
+    for (Var v = 0; v < nVars(); v++)
+        if (!isEliminated(v) && value(v) == l_Undef)
+            for (int s = 0; s < 2; s++)
+                if (n_occ[mkLit(v, s)] > 1)
+                    queue.insert(mkLit(v, s));
+
+    vec<Lit>  mlits, cand_lits, sorted;
+    vec<CRef> mcls, cand_cls, replaced;
+    vec<Lit>  lits;
+    while (!queue.empty() && ticks < limit){
+        Lit l = queue.removeMin();
+        if (value(l) != l_Undef || isEliminated(var(l)) || n_occ[l] < 2) continue;
+
+        mlits.clear();
+        mlits.push(l);
+        collectOccurrences(l, mcls);
+
+        // Greedily extend the literal set as long as the reduction grows:
+        for (;;){
+            cand_lits.clear();
+            cand_cls .clear();
+            for (int i = 0; i < mcls.size(); i++){
+                const Clause& c = ca[mcls[i]];
+
+                // Candidates are found among the clauses of the least occurring literal of 'c':
+                Lit lmin = lit_Undef;
+                for (int j = 0; j < c.size(); j++)
+                    if (c[j] != l && (lmin == lit_Undef || n_occ[c[j]] < n_occ[lmin]))
+                        lmin = c[j];
+                if (lmin == lit_Undef) continue;
+
+                for (int j = 0; j < c.size(); j++)
+                    seen[var(c[j])] = 1 + sign(c[j]);
+
+                const vec<CRef>& cls = occurs.lookup(var(lmin));
+                for (int k = 0; k < cls.size(); k++){
+                    const Clause& d = ca[cls[k]];
+                    if (cls[k] == mcls[i] || d.mark() != 0 || d.size() != c.size()) continue;
+                    ticks += d.size();
+
+                    // 'd' must equal 'c' with 'l' replaced by a single other literal:
+                    Lit other = lit_Undef;
+                    int j     = 0;
+                    for (; j < d.size(); j++)
+                        if (d[j] == l || seen[var(d[j])] != 1 + sign(d[j])){
+                            if (other != lit_Undef) break;
+                            other = d[j]; }
+                    if (j < d.size() || other == lit_Undef || var(other) == var(l) || find(mlits, other)) continue;
+
+                    cand_lits.push(other);
+                    cand_cls .push(mcls[i]);
+                }
+
+                for (int j = 0; j < c.size(); j++)
+                    seen[var(c[j])] = 0;
+            }
+
+            // Pick the candidate literal occurring most often:
+            cand_lits.copyTo(sorted);
+            sort(sorted);
+            Lit lmax = lit_Undef;
+            int best = 0;
+            for (int i = 0, j; i < sorted.size(); i = j){
+                for (j = i; j < sorted.size() && sorted[j] == sorted[i]; j++);
+                if (j - i > best){
+                    best = j - i;
+                    lmax = sorted[i]; }
+            }
+
+            if (lmax == lit_Undef || bvaReduction(mlits.size() + 1, best) <= bvaReduction(mlits.size(), mcls.size()))
+                break;
+
+            mlits.push(lmax);
+            mcls.clear();
+            for (int i = 0; i < cand_lits.size(); i++)
+                if (cand_lits[i] == lmax && (mcls.size() == 0 || mcls.last() != cand_cls[i]))
+                    mcls.push(cand_cls[i]);
+        }
+
+        if (mlits.size() == 1 || bvaReduction(mlits.size(), mcls.size()) <= 0)
+            continue;
+
+        // Locate all clauses to be replaced:
+        replaced.clear();
+        for (int i = 0; i < mcls.size(); i++){
+            const Clause& c = ca[mcls[i]];
+            for (int j = 0; j < c.size(); j++)
+                seen[var(c[j])] = 1 + sign(c[j]);
+            replaced.push(mcls[i]);
+            for (int k = 1; k < mlits.size(); k++){
+                CRef d = findReplaced(c, l, mlits[k]);
+                if (d != CRef_Undef) replaced.push(d);
+            }
+            for (int j = 0; j < c.size(); j++)
+                seen[var(c[j])] = 0;
+        }
+        if (replaced.size() != mlits.size() * mcls.size())
+            continue;
+
+        // Introduce the new variable. It stays a decision variable, but is placed behind all problem
+        // variables in the order heap until conflict analysis bumps it:
+        Var x = newVar();
+        activity[x] = -1;
+        order_heap.update(x);
+        for (int i = 0; i < mcls.size(); i++){
+            const Clause& c = ca[mcls[i]];
+            lits.clear();
+            for (int j = 0; j < c.size(); j++)
+                if (c[j] != l) lits.push(c[j]);
+            lits.push(mkLit(x));
+            if (!addClause_(lits))
+                return false;
+        }
+        for (int i = 0; i < mlits.size(); i++){
+            lits.clear();
+            lits.push(mlits[i]);
+            lits.push(~mkLit(x));
+            if (!addClause_(lits))
+                return false; }
+
+        // Remove the old clauses, and requeue their literals with updated occurrence counts:
+        lits.clear();
+        for (int i = 0; i < replaced.size(); i++){
+            const Clause& c = ca[replaced[i]];
+            if (c.mark() != 0) continue;
+            for (int j = 0; j < c.size(); j++)
+                lits.push(c[j]);
+            removeClause(replaced[i]);
+        }
+        lits.push(mkLit(x));
+        lits.push(~mkLit(x));
+        for (int i = 0; i < lits.size(); i++)
+            if (!isEliminated(var(lits[i])) && value(lits[i]) == l_Undef)
+                queue.update(lits[i]);
+    }
+
+    if (verbosity >= 1 && nVars() > vars0)
+        printf("|  BVA: %7d variables added, %8d clauses removed                     |\n",
+               nVars() - vars0, clauses0 - nClauses());
+
+    return true;
+}
+
+
+// Lexicographic order of the literal sequences 'start[i]' to 'start[i+1]' of 'lits':
+struct LitSeqLt {
+    const vec<Lit>& lits;
+    const vec<int>& start;
+    LitSeqLt(const vec<Lit>& l, const vec<int>& s) : lits(l), start(s) {}
+    bool operator()(int a, int b) const {
+        int i = start[a], j = start[b];
+        for (; i < start[a+1] && j < start[b+1]; i++, j++)
+            if (lits[i] != lits[j]) return lits[i] < lits[j];
+        return i == start[a+1] && j < start[b+1]; }
+};
+
+// Static symmetry breaking: automorphisms of the graph with a vertex for every literal and clause
+// (literals are adjacent to their negation and to the clauses they occur in) are permutations of
+// the literals that map the clauses onto themselves. For at most 'sym_gens' generators, assignments
+// must be lexicographically no larger than their images (in the order of the variables), compared
+// on the first 'sym_size' moved variables with a chain of 'equal so far' variables. Frozen
+// variables get colors of their own and are never moved, so constraints that are not clauses stay
+// symmetric.
+bool SimpSolver::breakSymmetries()
+{
+    assert(decisionLevel() == 0);
+
+    // Collect the unassigned literals of the clauses, sorted, and drop duplicate clauses (they would
+    // only give generators swapping them):
+    vec<Lit> lits;
+    vec<int> start, order;
+    for (int i = 0; i < clauses.size(); i++){
+        const Clause& c = ca[clauses[i]];
+        if (c.mark() != 0 || satisfied(c)) continue;
+        order.push(start.size());
+        start.push(lits.size());
+        for (int j = 0; j < c.size(); j++)
+            if (value(c[j]) == l_Undef)
+                lits.push(c[j]);
+        sort(&lits[start.last()], lits.size() - start.last());
+    }
+    start.push(lits.size());
+    sort(order, LitSeqLt(lits, start));
+
+    // Number the literals of the variables occurring in clauses, then the clauses:
+    vec<int>  index(nVars(), -1);
+    vec<Var>  vars;
+    vec<int>  cls;
+    for (int i = 0; i < order.size(); i++){
+        int k = order[i];
+        if (i > 0 && !LitSeqLt(lits, start)(order[i-1], k)) continue;
+        for (int j = start[k]; j < start[k+1]; j++)
+            if (index[var(lits[j])] == -1){
+                index[var(lits[j])] = vars.size();
+                vars.push(var(lits[j])); }
+        cls.push(k);
+    }
+    if (vars.size() == 0) return true;
+
+    int            nlits = 2*vars.size();
+    SymmetryFinder sf(nlits + cls.size());
+    for (int i = 0; i < vars.size(); i++){
+        sf.addEdge(2*i, 2*i+1);
+        if (frozen[vars[i]]){
+            sf.setColor(2*i,   2 + 2*i);
+            sf.setColor(2*i+1, 3 + 2*i); }
+    }
+    for (int i = 0; i < cls.size(); i++){
+        sf.setColor(nlits + i, 1);
+        for (int j = start[cls[i]]; j < start[cls[i]+1]; j++)
+            sf.addEdge(2*index[var(lits[j])] + sign(lits[j]), nlits + i);
+    }
+    int n_gens = sf.findGenerators(sym_gens, sym_lim);
+    ticks += sf.work;
+
+    int      vars0    = nVars();
+    int      clauses0 = nClauses();
+    vec<Lit> image(nVars(), lit_Undef);
+    vec<int> from, to;
+    vec<Var> support;
+    vec<Lit> ps;
+    for (int g = 0; g < n_gens; g++){
+        sf.generator(g, from, to);
+        support.clear();
+        for (int i = 0; i < from.size(); i++)
+            if (from[i] < nlits && (from[i] & 1) == 0){
+                Var v = vars[from[i] / 2];
+                image[v] = mkLit(vars[to[i] / 2], to[i] & 1);
+                support.push(v); }
+        sort(support);
+
+        // 'x_i <= y_i' for the first variable 'x_i' where 'x' and its image 'y' differ:
+        Lit eq = lit_Undef;
+        int k  = support.size() < sym_size ? support.size() : sym_size;
+        for (int i = 0; i < k; i++){
+            Lit x = mkLit(support[i]);
+            Lit y = image[support[i]];
+            ps.clear();
+            if (eq != lit_Undef) ps.push(~eq);
+            ps.push(~x);
+            ps.push(y);
+            if (!addClause_(ps)) return false;
+            if (y == ~x || i == k - 1) break;
+
+            Lit next = mkLit(newVar());
+            ps.clear();
+            if (eq != lit_Undef) ps.push(~eq);
+            ps.push(~x);
+            ps.push(next);
+            if (!addClause_(ps)) return false;
+            ps.clear();
+            if (eq != lit_Undef) ps.push(~eq);
+            ps.push(y);
+            ps.push(next);
+            if (!addClause_(ps)) return false;
+            eq = next;
+        }
+    }
+    sym_generators += n_gens;
+
+    if (verbosity >= 1)
+        printf("|  Symmetry: %5d generators, %7d variables, %8d clauses added      |\n",
+               n_gens, nVars() - vars0, nClauses() - clauses0);
+
+    return propagate() == CRef_Undef;
+}
+
+
 void SimpSolver::extendModel()
 {
     int i, j;
@@ -599,6 +1776,47 @@ bool SimpSolver::eliminate(bool turn_off_elim)
     else if (!use_simplification)
         return true;
 
+    // A wall-clock deadline is otherwise only noticed by 'propagate()': it is polled before each
+    // step, and every 64 variables of the elimination loop.
+
+    // Equivalent literal substitution:
+    //
+    if (use_els && !deadlinePassed() && !substituteEquivalences()){
+        ok = false; goto cleanup; }
+
+    // Symmetry breaking (only once, when simplification is turned off for good). Its clauses would
+    // not hold under assumptions on variables frozen later, or with clauses added later:
+    //
+    if (use_sym && turn_off_elim && !inprocessing){
+        use_sym = false;
+        if (!deadlinePassed() && !breakSymmetries()){
+            ok = false; goto cleanup; } }
+
+    // Gauss-Jordan elimination for XOR constraints (only up front, not while inprocessing):
+    //
+    if (use_gauss && !deadlinePassed() && !inprocessing && !detectXors()){
+        ok = false; goto cleanup; }
+
+    // Failed literal probing:
+    //
+    if (use_probing && !deadlinePassed() && !probe()){
+        ok = false; goto cleanup; }
+
+    // At-most-one constraints from cliques of binary clauses (only up front, not while inprocessing):
+    //
+    if (use_amo && !deadlinePassed() && !inprocessing && !detectCliques()){
+        ok = false; goto cleanup; }
+
+    // Blocked clause elimination:
+    //
+    if (use_bce && !deadlinePassed() && !blockedClauseElim()){
+        ok = false; goto cleanup; }
+
+    // Bounded variable addition (only up front, not while inprocessing):
+    //
+    if (use_bva && !deadlinePassed() && !inprocessing && !boundedVariableAddition()){
+        ok = false; goto cleanup; }
+
     // Main simplification loop:
     //
     while (n_touched > 0 || bwdsub_assigns < trail.size() || elim_heap.size() > 0){
@@ -609,6 +1827,10 @@ bool SimpSolver::eliminate(bool turn_off_elim)
             !backwardSubsumptionCheck(true)){
             ok = false; goto cleanup; }
 
+        // Keep the remaining variables for the next round when the budget is exhausted:
+        if (ticks >= simp_tick_limit || deadlinePassed())
+            goto cleanup;
+
         // Empty elim_heap and return immediately on user-interrupt:
         if (asynch_interrupt){
             assert(bwdsub_assigns == trail.size());
@@ -619,9 +1841,9 @@ bool SimpSolver::eliminate(bool turn_off_elim)
 
         // printf("  ## (time = %6.2f s) ELIM: vars = %d\n", cpuTime(), elim_heap.size());
         for (int cnt = 0; !elim_heap.empty(); cnt++){
+            if (asynch_interrupt || ticks >= simp_tick_limit || (cnt % 64 == 0 && deadlinePassed())) break;
+
             Var elim = elim_heap.removeMin();
-            
-            if (asynch_interrupt) break;
 
             if (isEliminated(elim) || value(elim) != l_Undef) continue;
 
@@ -649,27 +1871,13 @@ bool SimpSolver::eliminate(bool turn_off_elim)
  cleanup:
 
     // If no more simplification is needed, free all simplification-related data structures:
-    if (turn_off_elim){
-        touched  .clear(true);
-        occurs   .clear(true);
-        n_occ    .clear(true);
-        elim_heap.clear(true);
-        subsumption_queue.clear(true);
-
-        use_simplification    = false;
-        remove_satisfied      = true;
-        ca.extra_clause_field = false;
-        max_simp_var          = nVars();
-
-        // Force full cleanup (this is safe and desirable since it only happens once):
-        rebuildOrderHeap();
-        garbageCollect();
-    }else{
+    if (turn_off_elim)
+        disableSimplification();
+    else
         // Cheaper cleanup:
         checkGarbage();
-    }
 
-    if (verbosity >= 1 && elimclauses.size() > 0)
+    if (verbosity >= 1 && elimclauses.size() > 0 && !inprocessing)
         printf("|  Eliminated clauses:     %10.2f Mb                                      |\n", 
                double(elimclauses.size() * sizeof(uint32_t)) / (1024*1024));
 
@@ -677,12 +1885,204 @@ bool SimpSolver::eliminate(bool turn_off_elim)
 }
 
 
+void SimpSolver::disableSimplification()
+{
+    assert(use_simplification);
+    touched  .clear(true);
+    occurs   .clear(true);
+    n_occ    .clear(true);
+    elim_heap.clear(true);
+    subsumption_queue.clear(true);
+
+    use_simplification    = false;
+    remove_satisfied      = true;
+    ca.extra_clause_field = false;
+    max_simp_var          = nVars();
+
+    // Force full cleanup (this is safe and desirable since it happens rarely):
+    rebuildOrderHeap();
+    garbageCollect();
+}
+
+
+// Rebuild the occurrence lists after 'disableSimplification()'. Variables only get on the elimination
+// heap again when their clauses change (e.g. by new top-level assignments).
+void SimpSolver::enableSimplification()
+{
+    assert(!use_simplification);
+    assert(decisionLevel() == 0);
+
+    // Give the problem clauses their extra field back (the copies compute the abstraction used by
+    // subsumption):
+    ca.extra_clause_field = true;
+    garbageCollect();
+
+    use_simplification = true;
+    remove_satisfied   = false;
+    for (Var v = 0; v < nVars(); v++){
+        n_occ  .insert( mkLit(v), 0);
+        n_occ  .insert(~mkLit(v), 0);
+        occurs .init  (v);
+        touched.insert(v, 0);
+    }
+    for (int i = 0; i < clauses.size(); i++){
+        CRef    cr = clauses[i];
+        Clause& c  = ca[cr];
+        for (int j = 0; j < c.size(); j++){
+            occurs[var(c[j])].push(cr);
+            n_occ[c[j]]++;
+        }
+    }
+}
+
+
+// Remove learnt clauses containing eliminated variables or subsumed by a problem clause, and
+// strengthen learnt clauses by self-subsuming resolution with problem clauses.
+bool SimpSolver::subsumeLearnts()
+{
+    assert(decisionLevel() == 0);
+    assert(use_simplification);
+
+    int i, j;
+    for (i = j = 0; i < learnts.size(); i++){
+        CRef    cr = learnts[i];
+        Clause& c  = ca[cr];
+        if (c.mark() != 0) continue;
+
+        // Clauses with eliminated variables are removed even when the tick budget is exhausted:
+        bool remove = false;
+        Lit  best   = lit_Undef;
+        for (int k = 0; k < c.size() && !remove; k++)
+            if (isEliminated(var(c[k])))
+                remove = true;
+            else if (best == lit_Undef || occurs[var(c[k])].size() < occurs[var(best)].size())
+                best = c[k];
+
+        if (!remove && ticks >= simp_tick_limit){
+            learnts[j++] = cr;
+            continue; }
+
+        // Find a problem clause subsuming 'c', or one whose resolvent with 'c' subsumes 'c':
+        Lit strengthen = lit_Undef;
+        if (!remove){
+            for (int k = 0; k < c.size(); k++)
+                seen[var(c[k])] = 1 + sign(c[k]);
+
+            const vec<CRef>& cls = occurs.lookup(var(best));
+            ticks += cls.size();
+            for (int k = 0; k < cls.size() && !remove && strengthen == lit_Undef; k++){
+                const Clause& d = ca[cls[k]];
+                if (d.size() > c.size()) continue;
+
+                Lit opposite = lit_Undef;
+                int m        = 0;
+                for (; m < d.size(); m++)
+                    if (seen[var(d[m])] == 1 + sign(d[m]))
+                        continue;
+                    else if (seen[var(d[m])] != 0 && opposite == lit_Undef)
+                        opposite = d[m];
+                    else
+                        break;
+                if (m < d.size()) continue;
+
+                if (opposite == lit_Undef) remove = true;
+                else                       strengthen = ~opposite;
+            }
+
+            for (int k = 0; k < c.size(); k++)
+                seen[var(c[k])] = 0;
+        }
+
+        if (remove){
+            Solver::removeClause(cr);
+            continue; }
+        if (strengthen == lit_Undef){
+            learnts[j++] = cr;
+            continue; }
+
+        // Strengthen, also dropping literals false at the top level (so that the watched literals
+        // are not false):
+        int remaining = 0;
+        Lit unit      = lit_Undef;
+        for (int k = 0; k < c.size(); k++)
+            if (c[k] != strengthen && value(c[k]) != l_False){
+                remaining++;
+                unit = c[k]; }
+
+        if (remaining <= 1){
+            Solver::removeClause(cr);
+            if (remaining == 0 || !enqueue(unit) || propagate() != CRef_Undef)
+                return ok = false;
+        }else{
+            detachClause(cr, true);
+            int k, m;
+            for (k = m = 0; k < c.size(); k++)
+                if (c[k] != strengthen && value(c[k]) != l_False)
+                    c[m++] = c[k];
+            c.shrink(k - m);
+            attachClause(cr);
+            learnts[j++] = cr;
+        }
+    }
+    learnts.shrink(i - j);
+
+    return true;
+}
+
+
+// Called between restarts: simplify the formula further, within an effort relative to the search
+// work since the last round. Simplification is temporarily re-enabled if it was turned off.
+bool SimpSolver::inprocess()
+{
+    assert(decisionLevel() == 0);
+    if (!ok) return false;
+
+    bool     was_simp = use_simplification;
+    uint64_t budget   = (uint64_t)((ticks - inprocess_ticks) * inprocess_effort);
+
+    // Turning simplification on and off again costs two garbage collections and building the
+    // occurrence lists. This is charged to the round, which is skipped if its budget is too small:
+    if (!was_simp){
+        uint64_t setup = 3 * clauses_literals + 2 * learnts_literals;
+        if (budget <= setup) return true;
+        budget -= setup;
+        ticks  += setup;
+        enableSimplification(); }
+
+    // Assumptions must not be eliminated:
+    vec<Var> extra_frozen;
+    for (int i = 0; i < assumptions.size(); i++){
+        Var v = var(assumptions[i]);
+        if (!frozen[v]){
+            setFrozen(v, true);
+            extra_frozen.push(v); } }
+
+    inprocessing    = true;
+    simp_tick_limit = ticks + budget;
+    bool result     = eliminate(false) && subsumeLearnts();
+    simp_tick_limit = UINT64_MAX;
+    inprocessing    = false;
+
+    for (int i = 0; i < extra_frozen.size(); i++)
+        setFrozen(extra_frozen[i], false);
+
+    if (!was_simp)
+        disableSimplification();
+
+    return result;
+}
+
+
 //=================================================================================================
 // Garbage Collection methods:
 
 
 void SimpSolver::relocAll(ClauseAllocator& to)
 {
+    // Temporary clause (kept alive while simplification is off, since it may be turned on again):
+    //
+    ca.reloc(bwdsub_tmpunit, to);
+
     if (!use_simplification) return;
 
     // All occurs lists:
@@ -702,10 +2102,6 @@ void SimpSolver::relocAll(ClauseAllocator& to)
         ca.reloc(cr, to);
         subsumption_queue.insert(cr);
     }
-        
-    // Temporary clause:
-    //
-    ca.reloc(bwdsub_tmpunit, to);
 }
 
 
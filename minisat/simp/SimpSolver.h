@@ -23,6 +23,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include "minisat/mtl/Queue.h"
 #include "minisat/core/Solver.h"
+#include "minisat/core/Gauss.h"
 
 
 namespace Minisat {
@@ -48,6 +49,15 @@ class SimpSolver : public Solver {
     bool    addClause (Lit p, Lit q, Lit r); // Add a ternary clause to the solver.
     bool    addClause (Lit p, Lit q, Lit r, Lit s); // Add a quaternary clause to the solver. 
     bool    addClause_(      vec<Lit>& ps);
+    bool    addAtMost (const vec<Lit>& ps, int k); // Cardinality constraints (see 'Solver'); their variables are frozen.
+    bool    addAtLeast(const vec<Lit>& ps, int k);
+    bool    addPb     (const vec<Lit>& ps, const vec<int64_t>& cs, int64_t bound);
+    bool    addCanonicity(int n, const vec<Lit>& edges);
+    bool    addConnectivity(int n, const vec<Lit>& edges);
+    bool    addAcyclicity  (int n, const vec<Lit>& arcs);
+    CRef    addExternalClause(const vec<Lit>& ps);
+    int     addRemovableClause(const vec<Lit>& ps); // The activation variable is frozen.
+    void    push      ();                      // The activation variable of the scope is frozen.
     bool    substitute(Var v, Lit x);  // Replace all occurences of v with x (may cause a contradiction).
 
     // Variable mode:
@@ -96,6 +106,25 @@ class SimpSolver : public Solver {
     bool    use_asymm;         // Shrink clauses by asymmetric branching.
     bool    use_rcheck;        // Check if a clause is already implied. Prett costly, and subsumes subsumptions :)
     bool    use_elim;          // Perform variable elimination.
+    bool    use_els;           // Substitute equivalent literals (strongly connected components of binary implications).
+    bool    use_gates;         // Restrict the resolvents of variable elimination using detected gate definitions.
+    bool    use_probing;       // Probe for failed literals, necessary assignments and hyper-binary resolvents.
+    int     probe_lim;         // Effort limit for probing in ticks.
+    bool    use_bce;           // Perform blocked clause elimination.
+    int     bce_lim;           // Effort limit for blocked clause elimination in ticks.
+    bool    use_bva;           // Perform bounded variable addition (introduces new variables).
+    int     bva_lim;           // Effort limit for bounded variable addition in ticks.
+    bool    use_gauss;         // Propagate XOR constraints found among the clauses by Gauss-Jordan elimination.
+    int     xor_size;          // Largest XOR constraint to detect.
+    bool    use_sym;           // Break symmetries of the clauses by lex-leader clauses (introduces new variables). Done once, by
+                               // 'eliminate(true)', which clears the flag; clauses added later and assumptions on variables that
+                               // were not frozen then are unsupported.
+    int     sym_gens;          // Maximum number of symmetry generators to break.
+    int     sym_size;          // Maximum number of variables compared for each generator.
+    int     sym_lim;           // Effort limit for symmetry detection in ticks.
+    bool    use_amo;           // Replace cliques of binary clauses by native at-most-one constraints.
+    int     amo_min;           // Smallest clique to replace.
+    int     amo_lim;           // Effort limit for clique detection in ticks.
     bool    extend_model;      // Flag to indicate whether the user needs to look at the full model.
 
     // Statistics:
@@ -103,6 +132,11 @@ class SimpSolver : public Solver {
     int     merges;
     int     asymm_lits;
     int     eliminated_vars;
+    int     substituted_vars;
+    int     gate_elims;
+    int     xors;
+    int     sym_generators;
+    int     amo_cliques;
 
  protected:
 
@@ -146,6 +180,10 @@ class SimpSolver : public Solver {
     VMap<char>          eliminated;
     int                 bwdsub_assigns;
     int                 n_touched;
+    bool                inprocessing;        // Set during a round of 'inprocess()'.
+    uint64_t            simp_tick_limit;     // Simplification stops when 'ticks' reaches this (set while inprocessing).
+    vec<GaussPropagator*>
+                        matrices;            // XOR constraints found by 'detectXors()' (owned).
 
     // Temporaries:
     //
@@ -161,13 +199,28 @@ class SimpSolver : public Solver {
     bool          merge                    (const Clause& _ps, const Clause& _qs, Var v, vec<Lit>& out_clause);
     bool          merge                    (const Clause& _ps, const Clause& _qs, Var v, int& size);
     bool          backwardSubsumptionCheck (bool verbose = false);
+    bool          findGate                 (Var v, const vec<CRef>& pos, const vec<CRef>& neg, vec<char>& pos_gate, vec<char>& neg_gate);
     bool          eliminateVar             (Var v);
+    bool          substituteEquivalences   ();
+    bool          detectXors               ();
+    bool          probe                    ();
+    bool          blockedClauseElim        ();
+    bool          boundedVariableAddition  ();
+    bool          breakSymmetries          ();
+    bool          detectCliques            ();
+    void          collectOccurrences       (Lit l, vec<CRef>& out);
+    CRef          findReplaced             (const Clause& c, Lit l, Lit lit);
     void          extendModel              ();
 
     void          removeClause             (CRef cr);
     bool          strengthenClause         (CRef cr, Lit l);
     bool          implied                  (const vec<Lit>& c);
     void          relocAll                 (ClauseAllocator& to);
+
+    bool          inprocess                ();
+    bool          subsumeLearnts           ();
+    void          enableSimplification     ();
+    void          disableSimplification    ();
 };
 
 
@@ -183,12 +236,12 @@ inline void SimpSolver::updateElimHeap(Var v) {
         elim_heap.update(v); }
 
 
-inline bool SimpSolver::addClause    (const vec<Lit>& ps)    { ps.copyTo(add_tmp); return addClause_(add_tmp); }
-inline bool SimpSolver::addEmptyClause()                     { add_tmp.clear(); return addClause_(add_tmp); }
-inline bool SimpSolver::addClause    (Lit p)                 { add_tmp.clear(); add_tmp.push(p); return addClause_(add_tmp); }
-inline bool SimpSolver::addClause    (Lit p, Lit q)          { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); return addClause_(add_tmp); }
-inline bool SimpSolver::addClause    (Lit p, Lit q, Lit r)   { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); return addClause_(add_tmp); }
-inline bool SimpSolver::addClause    (Lit p, Lit q, Lit r, Lit s){ add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); add_tmp.push(s); return addClause_(add_tmp); }
+inline bool SimpSolver::addClause    (const vec<Lit>& ps)    { ps.copyTo(add_tmp); return addScoped(add_tmp); }
+inline bool SimpSolver::addEmptyClause()                     { add_tmp.clear(); return addScoped(add_tmp); }
+inline bool SimpSolver::addClause    (Lit p)                 { add_tmp.clear(); add_tmp.push(p); return addScoped(add_tmp); }
+inline bool SimpSolver::addClause    (Lit p, Lit q)          { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); return addScoped(add_tmp); }
+inline bool SimpSolver::addClause    (Lit p, Lit q, Lit r)   { add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); return addScoped(add_tmp); }
+inline bool SimpSolver::addClause    (Lit p, Lit q, Lit r, Lit s){ add_tmp.clear(); add_tmp.push(p); add_tmp.push(q); add_tmp.push(r); add_tmp.push(s); return addScoped(add_tmp); }
 inline void SimpSolver::setFrozen    (Var v, bool b) { frozen[v] = (char)b; if (use_simplification && !b) { updateElimHeap(v); } }
 
 inline void SimpSolver::freezeVar(Var v){
@@ -0,0 +1,356 @@
+/*************************************************************************************[Symmetry.cc]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#include "minisat/mtl/Sort.h"
+#include "minisat/simp/Symmetry.h"
+
+using namespace Minisat;
+
+namespace {
+struct ColorLt {
+    const vec<int>& color;
+    ColorLt(const vec<int>& c) : color(c) {}
+    bool operator()(int u, int v) const { return color[u] < color[v]; } };
+
+struct TouchedLt {
+    const vec<int>& cell;
+    const vec<int>& cnt;
+    TouchedLt(const vec<int>& ce, const vec<int>& cn) : cell(ce), cnt(cn) {}
+    bool operator()(int u, int v) const { return cell[u] < cell[v] || (cell[u] == cell[v] && cnt[u] < cnt[v]); } };
+}
+
+static inline uint64_t mix(uint64_t h, uint64_t x){
+    h = (h ^ (x + 0x9e3779b97f4a7c15ULL)) * 0xbf58476d1ce4e5b9ULL;
+    return h ^ (h >> 31); }
+
+
+SymmetryFinder::SymmetryFinder(int n_vertices) :
+    work(0), n(n_vertices), max_gens(0), budget(0), stop(false), mark_stamp(0)
+{
+    color.growTo(n, 0);
+    gen_start.push(0);
+}
+
+
+void SymmetryFinder::addEdge(int u, int v) { edge_list.push(u); edge_list.push(v); }
+void SymmetryFinder::setColor(int v, int c) { color[v] = c; }
+
+
+void SymmetryFinder::generator(int g, vec<int>& from, vec<int>& to) const
+{
+    from.clear();
+    to  .clear();
+    for (int i = gen_start[g]; i < gen_start[g+1]; i++){
+        from.push(gen_from[i]);
+        to  .push(gen_to[i]); }
+}
+
+
+int SymmetryFinder::findGenerators(int max_gens_, int64_t budget_)
+{
+    max_gens = max_gens_;
+    budget   = budget_;
+    stop     = false;
+
+    // Build the adjacency lists:
+    adj_start.growTo(n+1, 0);
+    for (int i = 0; i < edge_list.size(); i++)
+        adj_start[edge_list[i]+1]++;
+    for (int v = 0; v < n; v++)
+        adj_start[v+1] += adj_start[v];
+    vec<int> fill;
+    adj_start.copyTo(fill);
+    adj.growTo(edge_list.size());
+    for (int i = 0; i < edge_list.size(); i += 2){
+        adj[fill[edge_list[i]]++]   = edge_list[i+1];
+        adj[fill[edge_list[i+1]]++] = edge_list[i]; }
+    edge_list.clear(true);
+
+    queued.growTo(n, 0);
+    cnt   .growTo(n, 0);
+    mark  .growTo(n, 0);
+    for (int v = 0; v < n; v++){
+        perm .push(v);
+        orbit.push(v); }
+
+    // Descend the first path:
+    initial(left);
+    level_trace.push(left.trace);
+    level_cells.push(left.ncells);
+    for (int t = 0; (t = target(left, t)) >= 0; ){
+        if (work > budget) return 0;
+        first_cell  .push(t);
+        first_vertex.push(left.elems[t]);
+        first_trail .push(left.trail.size());
+        individualize(left, left.elems[t]);
+        level_trace.push(left.trace);
+        level_cells.push(left.ncells);
+    }
+    left.elems.copyTo(leaf);
+
+    // From the bottom up, map the vertex of the first path to the others of its cell:
+    vec<int> cands;
+    for (int d = first_cell.size() - 1; d >= 0 && !stop; d--){
+        undo(left, first_trail[d], level_trace[d]);
+        int t = first_cell[d];
+        int v = first_vertex[d];
+        cands.clear();
+        for (int i = t; i < left.end[t]; i++)
+            cands.push(left.elems[i]);
+
+        left.elems.copyTo(right.elems);
+        left.pos  .copyTo(right.pos);
+        left.cell .copyTo(right.cell);
+        left.end  .copyTo(right.end);
+        right.trail.clear();
+        right.ncells = left.ncells;
+        right.trace  = left.trace;
+        work += n;
+
+        for (int i = 0; i < cands.size() && !stop; i++){
+            int w = cands[i];
+            if (findOrbit(w) == findOrbit(v)) continue;
+            uint64_t trace = right.trace;
+            individualize(right, w);
+            if (compatible(right, d+1) && searchRight(d+1) && nGenerators() >= max_gens)
+                stop = true;
+            undo(right, 0, trace);
+            if (work > budget) stop = true;
+        }
+    }
+
+    return nGenerators();
+}
+
+
+// Search below a node of 'right' that matches depth 'd' of the first path for an automorphism:
+bool SymmetryFinder::searchRight(int d)
+{
+    if (d == first_cell.size())
+        return automorphism();
+
+    int t = first_cell[d];
+    if (right.cell[right.elems[t]] != t || right.end[t] - t < 2)
+        return false;
+    vec<int> ws;
+    for (int i = t; i < right.end[t]; i++)
+        ws.push(right.elems[i]);
+    work += ws.size();
+
+    for (int i = 0; i < ws.size(); i++){
+        int      trail = right.trail.size();
+        uint64_t trace = right.trace;
+        individualize(right, ws[i]);
+        bool found = compatible(right, d+1) && searchRight(d+1);
+        undo(right, trail, trace);
+        if (found) return true;
+        if (work > budget){
+            stop = true;
+            return false; }
+    }
+    return false;
+}
+
+
+// Check whether the discrete partitions 'leaf' and 'right' map the graph onto itself (and if so,
+// record the generator):
+bool SymmetryFinder::automorphism()
+{
+    int start = gen_from.size();
+    for (int i = 0; i < n; i++)
+        if (leaf[i] != right.elems[i]){
+            perm[leaf[i]] = right.elems[i];
+            gen_from.push(leaf[i]);
+            gen_to  .push(right.elems[i]); }
+    work += n;
+
+    bool ok = gen_from.size() > start;
+    for (int i = start; ok && i < gen_from.size(); i++){
+        int u = gen_from[i], x = gen_to[i];
+        mark_stamp++;
+        for (int k = adj_start[x]; k < adj_start[x+1]; k++)
+            mark[adj[k]] = mark_stamp;
+        for (int k = adj_start[u]; ok && k < adj_start[u+1]; k++)
+            ok = mark[perm[adj[k]]] == mark_stamp;
+        work += adj_start[u+1] - adj_start[u] + adj_start[x+1] - adj_start[x];
+    }
+    for (int i = start; i < gen_from.size(); i++)
+        perm[gen_from[i]] = gen_from[i];
+
+    if (!ok){
+        gen_from.shrink(gen_from.size() - start);
+        gen_to  .shrink(gen_to  .size() - start);
+        return false; }
+
+    gen_start.push(gen_from.size());
+    for (int i = start; i < gen_from.size(); i++){
+        int a = findOrbit(gen_from[i]), b = findOrbit(gen_to[i]);
+        if (a != b) orbit[a] = b; }
+    return true;
+}
+
+
+void SymmetryFinder::initial(Partition& P)
+{
+    for (int v = 0; v < n; v++)
+        P.elems.push(v);
+    sort(P.elems, ColorLt(color));
+    P.pos .growTo(n);
+    P.cell.growTo(n);
+    P.end .growTo(n, 0);
+    P.ncells = 0;
+    P.trace  = 0;
+    for (int i = 0, j; i < n; i = j){
+        for (j = i; j < n && color[P.elems[j]] == color[P.elems[i]]; j++){
+            P.pos [P.elems[j]] = j;
+            P.cell[P.elems[j]] = i; }
+        P.end[i] = j;
+        P.ncells++;
+        P.trace = mix(P.trace, j - i);
+        queue.push(i);
+        queued[i] = 1;
+    }
+    refine(P);
+}
+
+
+// Split cells by the number of neighbours in each queued cell until the partition is equitable:
+void SymmetryFinder::refine(Partition& P)
+{
+    for (int qi = 0; qi < queue.size(); qi++){
+        int s = queue[qi];
+        queued[s] = 0;
+        for (int i = s; i < P.end[s]; i++){
+            int v = P.elems[i];
+            for (int k = adj_start[v]; k < adj_start[v+1]; k++)
+                if (cnt[adj[k]]++ == 0)
+                    touched.push(adj[k]);
+            work += adj_start[v+1] - adj_start[v] + 1;
+        }
+
+        // Split the touched cells in order of their position (the same for isomorphic partitions):
+        sort(touched, TouchedLt(P.cell, cnt));
+        for (int i = 0, j; i < touched.size(); i = j){
+            int c = P.cell[touched[i]];
+            for (j = i; j < touched.size() && P.cell[touched[j]] == c; j++);
+            splitCell(P, c, &touched[i], j - i);
+        }
+
+        for (int i = 0; i < touched.size(); i++)
+            cnt[touched[i]] = 0;
+        touched.clear();
+    }
+    queue.clear();
+}
+
+
+// Split cell 'c' by the counts of its 't' touched vertices 'us' (sorted by count):
+void SymmetryFinder::splitCell(Partition& P, int c, const int* us, int t)
+{
+    int e = P.end[c];
+    if (t == e - c && cnt[us[0]] == cnt[us[t-1]])
+        return;
+
+    // Move the touched vertices to the back, in order (the others have count 0):
+    for (int j = 0; j < t; j++){
+        int u = us[j], p = e - t + j, w = P.elems[p];
+        P.elems[P.pos[u]] = w;
+        P.pos[w]          = P.pos[u];
+        P.elems[p]        = u;
+        P.pos[u]          = p; }
+    work += t;
+
+    P.trail.push(c);
+    P.trail.push(e);
+    P.trace = mix(P.trace, c);
+    int s = c;
+    for (int i = e - t; i < e; i++){
+        if (i > c && (i == e - t || cnt[P.elems[i]] != cnt[P.elems[i-1]])){
+            P.end[s] = i;
+            P.trace  = mix(P.trace, i - s);
+            P.ncells++;
+            s = i; }
+        if (s != c) P.cell[P.elems[i]] = s;
+    }
+    P.end[s] = e;
+    P.trace  = mix(mix(P.trace, e - s), cnt[P.elems[e-1]]);
+
+    // If 'c' is not queued, one of its parts (the largest) need not be:
+    int largest = c;
+    if (!queued[c])
+        for (int i = c; i < e; i = P.end[i])
+            if (P.end[i] - i > P.end[largest] - largest)
+                largest = i;
+    for (int i = c; i < e; i = P.end[i])
+        if (i != largest && !queued[i]){
+            queue.push(i);
+            queued[i] = 1; }
+}
+
+
+void SymmetryFinder::individualize(Partition& P, int v)
+{
+    int c = P.cell[v], e = P.end[c];
+    assert(e - c > 1);
+    int w = P.elems[c];
+    P.elems[P.pos[v]] = w;
+    P.pos[w]          = P.pos[v];
+    P.elems[c]        = v;
+    P.pos[v]          = c;
+
+    P.trail.push(c);
+    P.trail.push(e);
+    P.end[c]   = c + 1;
+    P.end[c+1] = e;
+    for (int i = c + 1; i < e; i++)
+        P.cell[P.elems[i]] = c + 1;
+    P.ncells++;
+    P.trace = mix(P.trace, c);
+    work += e - c;
+
+    queue.push(c);
+    queued[c] = 1;
+    refine(P);
+}
+
+
+// Merge the cells split since the trail had size 'trail_size':
+void SymmetryFinder::undo(Partition& P, int trail_size, uint64_t trace)
+{
+    while (P.trail.size() > trail_size){
+        int e = P.trail.last(); P.trail.pop();
+        int c = P.trail.last(); P.trail.pop();
+        for (int s = P.end[c]; s < e; s = P.end[s]){
+            P.ncells--;
+            for (int i = s; i < P.end[s]; i++)
+                P.cell[P.elems[i]] = c;
+        }
+        P.end[c] = e;
+        work += e - c;
+    }
+    P.trace = trace;
+}
+
+
+// The first non-singleton cell from cell 'from' on (cells before it only get split further):
+int SymmetryFinder::target(const Partition& P, int from) const
+{
+    for (int s = from; s < n; s = P.end[s])
+        if (P.end[s] - s > 1)
+            return s;
+    return -1;
+}
@@ -0,0 +1,110 @@
+/**************************************************************************************[Symmetry.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Symmetry_h
+#define Minisat_Symmetry_h
+
+#include "minisat/mtl/IntTypes.h"
+#include "minisat/mtl/Vec.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// SymmetryFinder -- generators of the automorphism group of a vertex-colored undirected graph:
+//
+// A partition of the vertices (initially by color) is refined until it is equitable, i.e. all
+// vertices of a cell have the same number of neighbours in every cell. Individualizing a vertex of
+// the first non-singleton cell and refining again, down to a discrete partition, gives the first
+// path. From the bottom of that path up, every other vertex of the cell that is not yet known to be
+// in the same orbit is individualized instead, and a path with the same refinement trace is searched
+// for whose discrete partition maps the first one to an automorphism. Generators found below a node
+// fix the vertices individualized above it, so their orbits prune the candidates there. Splits are
+// undone rather than partitions copied, and the search stops after 'budget' units of work (vertex
+// and edge visits).
+
+class SymmetryFinder {
+public:
+    SymmetryFinder(int n_vertices);
+
+    void     addEdge  (int u, int v);
+    void     setColor (int v, int c);           // Vertices of different colors are never mapped to each other.
+
+    int      findGenerators(int max_gens, int64_t budget);
+    int      nGenerators() const { return gen_start.size() - 1; }
+    void     generator(int g, vec<int>& from, vec<int>& to) const; // 'g' maps 'from[i]' to 'to[i]' and fixes the rest.
+
+    int64_t  work;
+
+protected:
+    struct Partition {
+        vec<int> elems;   // The vertices, grouped by cell,
+        vec<int> pos;     // the position of each vertex in 'elems',
+        vec<int> cell;    // the start of the cell of each vertex,
+        vec<int> end;     // and the end of each cell (indexed by its start).
+        vec<int> trail;   // Start and previous end of every split, to undo them.
+        int      ncells;
+        uint64_t trace;   // Hash of the splits so far (equal for isomorphic refinements).
+    };
+
+    int            n;
+    vec<int>       color;
+    vec<int>       edge_list;      // Pairs of endpoints, until 'findGenerators()' builds the adjacency.
+    vec<int>       adj_start;
+    vec<int>       adj;
+
+    Partition      left;           // The first path,
+    Partition      right;          // and the path compared with it.
+    vec<int>       first_cell;     // Target cell at each depth of the first path,
+    vec<int>       first_vertex;   // the vertex individualized in it,
+    vec<int>       first_trail;    // and the size of the trail before that.
+    vec<uint64_t>  level_trace;    // Trace and number of cells at each depth (one more than the above).
+    vec<int>       level_cells;
+    vec<int>       leaf;           // The discrete partition at the bottom of the first path.
+
+    vec<int>       orbit;          // Union-find of the orbits of the generators so far.
+    vec<int>       gen_from;       // Moved vertices of all generators, and their images
+    vec<int>       gen_to;         // ('gen_start[g]' indexes generator 'g').
+    vec<int>       gen_start;
+    int            max_gens;
+    int64_t        budget;
+    bool           stop;
+
+    // Temporaries:
+    vec<int>       queue;          // Splitting cells (by start), and whether each one is queued.
+    vec<char>      queued;
+    vec<int>       cnt;
+    vec<int>       touched;
+    vec<int>       perm;
+    vec<int>       mark;
+    int            mark_stamp;
+
+    void     initial      (Partition& P);
+    void     refine       (Partition& P);
+    void     splitCell    (Partition& P, int c, const int* us, int t);
+    void     individualize(Partition& P, int v);
+    void     undo         (Partition& P, int trail_size, uint64_t trace);
+    int      target       (const Partition& P, int from) const;
+    bool     compatible   (const Partition& P, int depth) const { return P.ncells == level_cells[depth] && P.trace == level_trace[depth]; }
+    bool     automorphism ();
+    bool     searchRight  (int depth);
+    int      findOrbit    (int v) { while (orbit[v] != v) v = orbit[v] = orbit[orbit[v]]; return v; }
+};
+
+//=================================================================================================
+}
+
+#endif
@@ -0,0 +1,73 @@
+/************************************************************************************[Histogram.h]
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT
+OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+**************************************************************************************************/
+
+#ifndef Minisat_Histogram_h
+#define Minisat_Histogram_h
+
+#include "minisat/mtl/IntTypes.h"
+#include "minisat/mtl/Vec.h"
+
+namespace Minisat {
+
+//=================================================================================================
+// Histogram -- counts of non-negative integer samples:
+//
+// Values below 16 get a bucket each, larger values are grouped in buckets [2^k, 2^(k+1)). This
+// keeps the small values that matter for clause sizes and LBDs exact while still bounding the
+// number of buckets for long-tailed quantities such as clause lifetimes.
+
+class Histogram {
+    vec<uint64_t> counts;
+    uint64_t      n;
+    uint64_t      total;
+    uint64_t      max_val;
+
+ public:
+    enum { Linear = 16 };
+
+    Histogram() : n(0), total(0), max_val(0) {}
+
+    static int bucket(uint64_t x){
+        if (x < Linear) return (int)x;
+        int b = Linear;
+        for (x >>= 5; x > 0; x >>= 1) b++;
+        return b; }
+
+    // Smallest value that falls into bucket 'b':
+    static uint64_t lower(int b){ return b < Linear ? (uint64_t)b : (uint64_t)1 << (b - Linear + 4); }
+
+    void add(uint64_t x){
+        int b = bucket(x);
+        if (counts.size() <= b) counts.growTo(b+1, 0);
+        counts[b]++;
+        n++;
+        total += x;
+        if (x > max_val) max_val = x; }
+
+    void clear(){ counts.clear(); n = total = max_val = 0; }
+
+    int      buckets ()      const { return counts.size(); }
+    uint64_t count   (int b) const { return counts[b]; }
+    uint64_t samples ()      const { return n; }
+    uint64_t max     ()      const { return max_val; }
+    double   mean    ()      const { return n > 0 ? (double)total / n : 0; }
+};
+
+//=================================================================================================
+}
+
+#endif
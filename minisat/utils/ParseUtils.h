@@ -26,6 +26,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include <zlib.h>
 
+#include "minisat/mtl/IntTypes.h"
 #include "minisat/mtl/XAlloc.h"
 
 namespace Minisat {
@@ -100,6 +101,21 @@ static int parseInt(B& in) {
     return neg ? -val : val; }
 
 
+template<class B>
+static int64_t parseInt64(B& in) {
+    int64_t val = 0;
+    bool    neg = false;
+    skipWhitespace(in);
+    if      (*in == '-') neg = true, ++in;
+    else if (*in == '+') ++in;
+    if (*in < '0' || *in > '9') fprintf(stderr, "PARSE ERROR! Unexpected char: %c\n", *in), exit(3);
+    while (*in >= '0' && *in <= '9'){
+        if (val > (INT64_MAX - (*in - '0')) / 10) fprintf(stderr, "PARSE ERROR! Integer out of range\n"), exit(3);
+        val = val*10 + (*in - '0'),
+        ++in; }
+    return neg ? -val : val; }
+
+
 // String matching: in case of a match the input iterator will be advanced the corresponding
 // number of characters.
 template<class B>